@@ -0,0 +1,712 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2024, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+// sta_bench generates a synthetic design (liberty, verilog, spef and
+// sdc) of a parameterized size, times each step of the timing flow on
+// it and writes the results as json so they can be compared between
+// builds.
+//
+// The design is a bank of registers separated by depth levels of
+// combinational gates. Every gate has fanout inputs, so every net
+// inside the logic cone drives fanout loads. Registers are spread
+// round robin across the clocks and the exceptions are false paths
+// and multicycle paths between registers.
+
+#include "StaMain.hh"
+#include "StaConfig.hh"  // STA_VERSION, STA_GIT_SHA1
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <tcl.h>
+
+#include "Machine.hh"
+#include "StringUtil.hh"
+#include "Report.hh"
+#include "MinMax.hh"
+#include "Network.hh"
+#include "Graph.hh"
+#include "PathEnd.hh"
+#include "VerilogReader.hh"
+#include "Sta.hh"
+
+namespace sta {
+extern const char *tcl_inits[];
+}
+
+using std::string;
+using sta::stdstrPrint;
+using sta::isDigits;
+using sta::findCmdLineFlag;
+using sta::findCmdLineKey;
+using sta::parseThreadsArg;
+using sta::evalTclInit;
+using sta::tcl_inits;
+using sta::elapsedRunTime;
+using sta::userRunTime;
+using sta::memoryUsage;
+using sta::peakMemoryUsage;
+using sta::Sta;
+using sta::Network;
+using sta::Graph;
+using sta::MinMaxAll;
+using sta::PathEndSeq;
+using sta::INF;
+
+// Swig uses C linkage for init functions.
+extern "C" {
+extern int Sta_Init(Tcl_Interp *interp);
+}
+
+namespace {
+
+class BenchDesign
+{
+public:
+  int depth;
+  int registers;
+  int fanout;
+  int clocks;
+  int exceptions;
+};
+
+class BenchResult
+{
+public:
+  string name;
+  int iterations;
+  // Minimum elapsed time over the iterations.
+  double elapsed;
+  double elapsed_mean;
+  double user;
+  // Memory growth during the step.
+  long memory;
+};
+
+typedef std::vector<BenchResult> BenchResultSeq;
+
+} // namespace
+
+static void
+showUsage(const char *prog);
+static int
+parseIntArg(int &argc,
+            char *argv[],
+            const char *key,
+            int default_value,
+            int min_value);
+static void
+writeLiberty(const char *filename,
+             const BenchDesign &design);
+static void
+writeVerilog(const char *filename,
+             const BenchDesign &design);
+static void
+writeSpef(const char *filename,
+          const BenchDesign &design);
+static void
+writeSdc(const char *filename,
+         const BenchDesign &design);
+static int
+driverIndex(const BenchDesign &design,
+            int level,
+            int load_index,
+            int input);
+static Sta *
+initBenchSta(Tcl_Interp *interp,
+             int thread_count);
+static void
+runFlow(Sta *sta,
+        Tcl_Interp *interp,
+        const string &dir,
+        int iterations,
+        BenchResultSeq &results);
+static void
+writeResults(FILE *stream,
+             Sta *sta,
+             const BenchDesign &design,
+             int thread_count,
+             const BenchResultSeq &results);
+
+int
+main(int argc,
+     char *argv[])
+{
+  if (findCmdLineFlag(argc, argv, "-help")) {
+    showUsage(argv[0]);
+    return 0;
+  }
+  BenchDesign design;
+  design.depth = parseIntArg(argc, argv, "-depth", 20, 0);
+  design.registers = parseIntArg(argc, argv, "-registers", 1000, 1);
+  design.fanout = parseIntArg(argc, argv, "-fanout", 2, 1);
+  design.clocks = parseIntArg(argc, argv, "-clocks", 2, 1);
+  design.exceptions = parseIntArg(argc, argv, "-exceptions", 10, 0);
+  int iterations = parseIntArg(argc, argv, "-iterations", 3, 1);
+  int thread_count = parseThreadsArg(argc, argv);
+  const char *dir_arg = findCmdLineKey(argc, argv, "-dir");
+  const char *json_filename = findCmdLineKey(argc, argv, "-json");
+  if (argc > 1) {
+    showUsage(argv[0]);
+    return 1;
+  }
+  if (design.clocks > design.registers)
+    design.clocks = design.registers;
+
+  string dir = dir_arg ? dir_arg : ".";
+  writeLiberty((dir + "/sta_bench.lib").c_str(), design);
+  writeVerilog((dir + "/sta_bench.v").c_str(), design);
+  writeSpef((dir + "/sta_bench.spef").c_str(), design);
+  writeSdc((dir + "/sta_bench.sdc").c_str(), design);
+
+  Tcl_Interp *interp = Tcl_CreateInterp();
+  if (Tcl_Init(interp) == TCL_ERROR) {
+    fprintf(stderr, "Error: %s\n", Tcl_GetStringResult(interp));
+    return 1;
+  }
+  Sta *sta = initBenchSta(interp, thread_count);
+  BenchResultSeq results;
+  runFlow(sta, interp, dir, iterations, results);
+
+  FILE *stream = stdout;
+  if (json_filename) {
+    stream = fopen(json_filename, "w");
+    if (stream == nullptr) {
+      fprintf(stderr, "Error: cannot write %s.\n", json_filename);
+      return 1;
+    }
+  }
+  writeResults(stream, sta, design, thread_count, results);
+  if (stream != stdout)
+    fclose(stream);
+  return 0;
+}
+
+static void
+showUsage(const char *prog)
+{
+  printf("Usage: %s [-help] [-depth n] [-registers n] [-fanout n] [-clocks n]\n", prog);
+  printf("       [-exceptions n] [-iterations n] [-threads count|max]\n");
+  printf("       [-dir dir] [-json filename]\n");
+  printf("  -help              show help and exit\n");
+  printf("  -depth n           levels of logic between registers (20)\n");
+  printf("  -registers n       register count (1000)\n");
+  printf("  -fanout n          gate inputs and net fanout (2)\n");
+  printf("  -clocks n          clock count (2)\n");
+  printf("  -exceptions n      false/multicycle path count (10)\n");
+  printf("  -iterations n      incremental update repetitions (3)\n");
+  printf("  -threads count|max use count threads\n");
+  printf("  -dir dir           directory for the generated design files (.)\n");
+  printf("  -json filename     write results to filename instead of stdout\n");
+}
+
+static int
+parseIntArg(int &argc,
+            char *argv[],
+            const char *key,
+            int default_value,
+            int min_value)
+{
+  char *arg = findCmdLineKey(argc, argv, key);
+  if (arg) {
+    if (isDigits(arg) && atoi(arg) >= min_value)
+      return atoi(arg);
+    else {
+      fprintf(stderr, "Error: %s must be an integer >= %d.\n", key, min_value);
+      exit(1);
+    }
+  }
+  return default_value;
+}
+
+////////////////////////////////////////////////////////////////
+//
+// Design generation.
+//
+////////////////////////////////////////////////////////////////
+
+static FILE *
+openBenchFile(const char *filename)
+{
+  FILE *stream = fopen(filename, "w");
+  if (stream == nullptr) {
+    fprintf(stderr, "Error: cannot write %s.\n", filename);
+    exit(1);
+  }
+  return stream;
+}
+
+static void
+writeLibertyTable(FILE *stream,
+                  const char *group,
+                  const char *templ,
+                  float scale)
+{
+  fprintf(stream, "        %s (%s) {\n", group, templ);
+  fprintf(stream, "          values (\"%.4f, %.4f, %.4f\", \\\n",
+          0.010 * scale, 0.050 * scale, 0.200 * scale);
+  fprintf(stream, "                  \"%.4f, %.4f, %.4f\", \\\n",
+          0.020 * scale, 0.060 * scale, 0.210 * scale);
+  fprintf(stream, "                  \"%.4f, %.4f, %.4f\");\n",
+          0.050 * scale, 0.090 * scale, 0.240 * scale);
+  fprintf(stream, "        }\n");
+}
+
+static void
+writeLibertyArc(FILE *stream,
+                const char *related_pin,
+                const char *timing_sense,
+                const char *timing_type,
+                float scale)
+{
+  fprintf(stream, "      timing () {\n");
+  fprintf(stream, "        related_pin : \"%s\";\n", related_pin);
+  if (timing_sense)
+    fprintf(stream, "        timing_sense : %s;\n", timing_sense);
+  if (timing_type)
+    fprintf(stream, "        timing_type : %s;\n", timing_type);
+  writeLibertyTable(stream, "cell_rise", "delay_3x3", scale);
+  writeLibertyTable(stream, "cell_fall", "delay_3x3", scale * 0.9);
+  writeLibertyTable(stream, "rise_transition", "delay_3x3", scale * 1.2);
+  writeLibertyTable(stream, "fall_transition", "delay_3x3", scale * 1.1);
+  fprintf(stream, "      }\n");
+}
+
+static void
+writeLibertyCheck(FILE *stream,
+                  const char *timing_type,
+                  float scale)
+{
+  fprintf(stream, "      timing () {\n");
+  fprintf(stream, "        related_pin : \"CK\";\n");
+  fprintf(stream, "        timing_type : %s;\n", timing_type);
+  writeLibertyTable(stream, "rise_constraint", "constraint_3x3", scale);
+  writeLibertyTable(stream, "fall_constraint", "constraint_3x3", scale);
+  fprintf(stream, "      }\n");
+}
+
+static void
+writeLiberty(const char *filename,
+             const BenchDesign &design)
+{
+  FILE *stream = openBenchFile(filename);
+  fprintf(stream, "library (sta_bench) {\n");
+  fprintf(stream, "  delay_model : table_lookup;\n");
+  fprintf(stream, "  time_unit : \"1ns\";\n");
+  fprintf(stream, "  voltage_unit : \"1V\";\n");
+  fprintf(stream, "  current_unit : \"1mA\";\n");
+  fprintf(stream, "  pulling_resistance_unit : \"1kohm\";\n");
+  fprintf(stream, "  leakage_power_unit : \"1nW\";\n");
+  fprintf(stream, "  capacitive_load_unit (1,pf);\n");
+  fprintf(stream, "  nom_process : 1.0;\n");
+  fprintf(stream, "  nom_voltage : 1.0;\n");
+  fprintf(stream, "  nom_temperature : 25.0;\n");
+  fprintf(stream, "  input_threshold_pct_rise : 50;\n");
+  fprintf(stream, "  input_threshold_pct_fall : 50;\n");
+  fprintf(stream, "  output_threshold_pct_rise : 50;\n");
+  fprintf(stream, "  output_threshold_pct_fall : 50;\n");
+  fprintf(stream, "  slew_lower_threshold_pct_rise : 20;\n");
+  fprintf(stream, "  slew_lower_threshold_pct_fall : 20;\n");
+  fprintf(stream, "  slew_upper_threshold_pct_rise : 80;\n");
+  fprintf(stream, "  slew_upper_threshold_pct_fall : 80;\n");
+  fprintf(stream, "  lu_table_template (delay_3x3) {\n");
+  fprintf(stream, "    variable_1 : input_net_transition;\n");
+  fprintf(stream, "    variable_2 : total_output_net_capacitance;\n");
+  fprintf(stream, "    index_1 (\"0.01, 0.1, 0.5\");\n");
+  fprintf(stream, "    index_2 (\"0.001, 0.01, 0.1\");\n");
+  fprintf(stream, "  }\n");
+  fprintf(stream, "  lu_table_template (constraint_3x3) {\n");
+  fprintf(stream, "    variable_1 : constrained_pin_transition;\n");
+  fprintf(stream, "    variable_2 : related_pin_transition;\n");
+  fprintf(stream, "    index_1 (\"0.01, 0.1, 0.5\");\n");
+  fprintf(stream, "    index_2 (\"0.01, 0.1, 0.5\");\n");
+  fprintf(stream, "  }\n");
+
+  // Gate with fanout inputs.
+  fprintf(stream, "  cell (NAND%d) {\n", design.fanout);
+  fprintf(stream, "    area : %d;\n", design.fanout + 1);
+  for (int i = 0; i < design.fanout; i++) {
+    fprintf(stream, "    pin (A%d) {\n", i);
+    fprintf(stream, "      direction : input;\n");
+    fprintf(stream, "      capacitance : 0.002;\n");
+    fprintf(stream, "    }\n");
+  }
+  string function = "!(";
+  for (int i = 0; i < design.fanout; i++) {
+    if (i > 0)
+      function += "&";
+    function += stdstrPrint("A%d", i);
+  }
+  function += ")";
+  fprintf(stream, "    pin (Y) {\n");
+  fprintf(stream, "      direction : output;\n");
+  fprintf(stream, "      function : \"%s\";\n", function.c_str());
+  for (int i = 0; i < design.fanout; i++)
+    writeLibertyArc(stream, stdstrPrint("A%d", i).c_str(), "negative_unate",
+                    nullptr, 1.0 + i * 0.1);
+  fprintf(stream, "    }\n");
+  fprintf(stream, "  }\n");
+
+  fprintf(stream, "  cell (DFF) {\n");
+  fprintf(stream, "    area : 6;\n");
+  fprintf(stream, "    ff (IQ,IQN) {\n");
+  fprintf(stream, "      next_state : \"D\";\n");
+  fprintf(stream, "      clocked_on : \"CK\";\n");
+  fprintf(stream, "    }\n");
+  fprintf(stream, "    pin (D) {\n");
+  fprintf(stream, "      direction : input;\n");
+  fprintf(stream, "      capacitance : 0.002;\n");
+  writeLibertyCheck(stream, "setup_rising", 0.5);
+  writeLibertyCheck(stream, "hold_rising", 0.1);
+  fprintf(stream, "    }\n");
+  fprintf(stream, "    pin (CK) {\n");
+  fprintf(stream, "      direction : input;\n");
+  fprintf(stream, "      clock : true;\n");
+  fprintf(stream, "      capacitance : 0.003;\n");
+  fprintf(stream, "    }\n");
+  fprintf(stream, "    pin (Q) {\n");
+  fprintf(stream, "      direction : output;\n");
+  fprintf(stream, "      function : \"IQ\";\n");
+  writeLibertyArc(stream, "CK", "non_unate", "rising_edge", 1.5);
+  fprintf(stream, "    }\n");
+  fprintf(stream, "  }\n");
+  fprintf(stream, "}\n");
+  fclose(stream);
+}
+
+// Index of the register (level 1) or gate (level > 1) in the previous
+// level that drives input of the gate at level/load_index.
+static int
+driverIndex(const BenchDesign &design,
+            int level,
+            int load_index,
+            int input)
+{
+  return (load_index + input * level) % design.registers;
+}
+
+static string
+netName(int level,
+        int index)
+{
+  return stdstrPrint("n_%d_%d", level, index);
+}
+
+static string
+driverPinName(int level,
+              int index)
+{
+  if (level == 0)
+    return stdstrPrint("r%d:Q", index);
+  else
+    return stdstrPrint("g_%d_%d:Y", level, index);
+}
+
+static void
+writeVerilog(const char *filename,
+             const BenchDesign &design)
+{
+  FILE *stream = openBenchFile(filename);
+  fprintf(stream, "module sta_bench (");
+  for (int c = 0; c < design.clocks; c++)
+    fprintf(stream, "%sclk%d", c > 0 ? ", " : "", c);
+  fprintf(stream, ");\n");
+  for (int c = 0; c < design.clocks; c++)
+    fprintf(stream, "  input clk%d;\n", c);
+  for (int level = 0; level <= design.depth; level++) {
+    for (int i = 0; i < design.registers; i++)
+      fprintf(stream, "  wire %s;\n", netName(level, i).c_str());
+  }
+  for (int i = 0; i < design.registers; i++)
+    fprintf(stream, "  DFF r%d (.D(%s), .CK(clk%d), .Q(%s));\n",
+            i,
+            netName(design.depth, i).c_str(),
+            i % design.clocks,
+            netName(0, i).c_str());
+  for (int level = 1; level <= design.depth; level++) {
+    for (int i = 0; i < design.registers; i++) {
+      fprintf(stream, "  NAND%d g_%d_%d (", design.fanout, level, i);
+      for (int input = 0; input < design.fanout; input++) {
+        int drvr = driverIndex(design, level, i, input);
+        fprintf(stream, ".A%d(%s), ", input, netName(level - 1, drvr).c_str());
+      }
+      fprintf(stream, ".Y(%s));\n", netName(level, i).c_str());
+    }
+  }
+  fprintf(stream, "endmodule\n");
+  fclose(stream);
+}
+
+static void
+writeSpef(const char *filename,
+          const BenchDesign &design)
+{
+  FILE *stream = openBenchFile(filename);
+  fprintf(stream, "*SPEF \"IEEE 1481-1998\"\n");
+  fprintf(stream, "*DESIGN \"sta_bench\"\n");
+  fprintf(stream, "*DATE \"\"\n");
+  fprintf(stream, "*VENDOR \"OpenSTA\"\n");
+  fprintf(stream, "*PROGRAM \"sta_bench\"\n");
+  fprintf(stream, "*VERSION \"%s\"\n", STA_VERSION);
+  fprintf(stream, "*DESIGN_FLOW \"PIN_CAP NONE\"\n");
+  fprintf(stream, "*DIVIDER /\n");
+  fprintf(stream, "*DELIMITER :\n");
+  fprintf(stream, "*BUS_DELIMITER []\n");
+  fprintf(stream, "*T_UNIT 1 NS\n");
+  fprintf(stream, "*C_UNIT 1 PF\n");
+  fprintf(stream, "*R_UNIT 1 KOHM\n");
+  fprintf(stream, "*L_UNIT 1 HENRY\n\n");
+  for (int level = 0; level <= design.depth; level++) {
+    for (int i = 0; i < design.registers; i++) {
+      string net_name = netName(level, i);
+      string drvr_name = driverPinName(level, i);
+      std::vector<string> loads;
+      if (level == design.depth)
+        loads.push_back(stdstrPrint("r%d:D", i));
+      else {
+        int load_level = level + 1;
+        for (int input = 0; input < design.fanout; input++) {
+          // Inverse of driverIndex.
+          int offset = (input * load_level) % design.registers;
+          int load = (i - offset + design.registers) % design.registers;
+          loads.push_back(stdstrPrint("g_%d_%d:A%d", load_level, load, input));
+        }
+      }
+      // Vary the wire loads so the arc delays are not all identical.
+      float wire_cap = 0.001 + 0.0002 * (i % 7);
+      float wire_res = 0.02 + 0.005 * (i % 5);
+      fprintf(stream, "*D_NET %s %.5f\n", net_name.c_str(), wire_cap);
+      fprintf(stream, "*CONN\n");
+      fprintf(stream, "*I %s O\n", drvr_name.c_str());
+      for (const string &load : loads)
+        fprintf(stream, "*I %s I\n", load.c_str());
+      fprintf(stream, "*CAP\n");
+      fprintf(stream, "1 %s:1 %.5f\n", net_name.c_str(), wire_cap);
+      fprintf(stream, "*RES\n");
+      fprintf(stream, "1 %s %s:1 %.4f\n",
+              drvr_name.c_str(), net_name.c_str(), wire_res);
+      int res_index = 2;
+      for (const string &load : loads)
+        fprintf(stream, "%d %s:1 %s %.4f\n",
+                res_index++, net_name.c_str(), load.c_str(), wire_res);
+      fprintf(stream, "*END\n\n");
+    }
+  }
+  fclose(stream);
+}
+
+static void
+writeSdc(const char *filename,
+         const BenchDesign &design)
+{
+  FILE *stream = openBenchFile(filename);
+  for (int c = 0; c < design.clocks; c++)
+    fprintf(stream, "create_clock -name clk%d -period %.1f [get_ports clk%d]\n",
+            c, 2.0 + c, c);
+  fprintf(stream, "set_input_transition 0.05 [all_inputs]\n");
+  for (int e = 0; e < design.exceptions; e++) {
+    int from = (e * 7) % design.registers;
+    int to = (e * 13 + 1) % design.registers;
+    if (e % 2 == 0)
+      fprintf(stream, "set_false_path -from [get_pins r%d/CK] -to [get_pins r%d/D]\n",
+              from, to);
+    else
+      fprintf(stream, "set_multicycle_path 2 -setup -from [get_pins r%d/CK] -to [get_pins r%d/D]\n",
+              from, to);
+  }
+  fclose(stream);
+}
+
+////////////////////////////////////////////////////////////////
+//
+// Benchmarks.
+//
+////////////////////////////////////////////////////////////////
+
+static Sta *
+initBenchSta(Tcl_Interp *interp,
+             int thread_count)
+{
+  sta::initSta();
+  Sta *sta = new Sta;
+  Sta::setSta(sta);
+  sta->makeComponents();
+  sta->setTclInterp(interp);
+  sta->setThreadCount(thread_count);
+
+  // Define swig TCL commands.
+  Sta_Init(interp);
+  // Eval encoded sta TCL sources.
+  evalTclInit(interp, tcl_inits);
+  Tcl_Eval(interp, "init_sta_cmds");
+  return sta;
+}
+
+// Time a step and append it to results.
+template <class STEP>
+static void
+runStep(const char *name,
+        int iterations,
+        BenchResultSeq &results,
+        STEP step)
+{
+  BenchResult result;
+  result.name = name;
+  result.iterations = iterations;
+  result.elapsed = INF;
+  result.elapsed_mean = 0.0;
+  result.user = 0.0;
+  size_t memory_begin = memoryUsage();
+  for (int i = 0; i < iterations; i++) {
+    double elapsed_begin = elapsedRunTime();
+    double user_begin = userRunTime();
+    step();
+    double elapsed = elapsedRunTime() - elapsed_begin;
+    result.elapsed = std::min(result.elapsed, elapsed);
+    result.elapsed_mean += elapsed / iterations;
+    result.user += (userRunTime() - user_begin) / iterations;
+  }
+  result.memory = static_cast<long>(memoryUsage()) - static_cast<long>(memory_begin);
+  results.push_back(result);
+}
+
+static void
+benchError(const char *step)
+{
+  fprintf(stderr, "Error: %s failed.\n", step);
+  exit(1);
+}
+
+static void
+runFlow(Sta *sta,
+        Tcl_Interp *interp,
+        const string &dir,
+        int iterations,
+        BenchResultSeq &results)
+{
+  string lib_filename = dir + "/sta_bench.lib";
+  string verilog_filename = dir + "/sta_bench.v";
+  string spef_filename = dir + "/sta_bench.spef";
+  string sdc_filename = dir + "/sta_bench.sdc";
+
+  runStep("liberty_read", 1, results, [&] () {
+    if (sta->readLiberty(lib_filename.c_str(), sta->cmdCorner(),
+                         MinMaxAll::all(), false) == nullptr)
+      benchError("liberty_read");
+  });
+  runStep("verilog_read", 1, results, [&] () {
+    sta->readNetlistBefore();
+    if (!sta::readVerilogFile(verilog_filename.c_str(), sta->networkReader()))
+      benchError("verilog_read");
+  });
+  runStep("link", 1, results, [&] () {
+    if (!sta->linkDesign("sta_bench"))
+      benchError("link");
+  });
+  runStep("sdc_read", 1, results, [&] () {
+    string cmd = "read_sdc {" + sdc_filename + "}";
+    if (Tcl_Eval(interp, cmd.c_str()) != TCL_OK) {
+      fprintf(stderr, "%s\n", Tcl_GetStringResult(interp));
+      benchError("sdc_read");
+    }
+  });
+  runStep("spef_read", 1, results, [&] () {
+    Network *network = sta->network();
+    if (!sta->readSpef(spef_filename.c_str(), network->topInstance(),
+                       sta->cmdCorner(), MinMaxAll::all(),
+                       false, false, 1.0, false))
+      benchError("spef_read");
+  });
+  runStep("graph_build", 1, results, [&] () {
+    sta->ensureGraph();
+  });
+  runStep("levelize", 1, results, [&] () {
+    sta->ensureLevelized();
+  });
+  runStep("delay_calc", 1, results, [&] () {
+    sta->findDelays();
+  });
+  runStep("arrivals", 1, results, [&] () {
+    sta->updateTiming(false);
+  });
+  runStep("requireds", 1, results, [&] () {
+    sta->findRequireds();
+  });
+  runStep("path_report", 1, results, [&] () {
+    PathEndSeq ends = sta->findPathEnds(nullptr, nullptr, nullptr, false,
+                                        nullptr, MinMaxAll::all(),
+                                        100, 1, true, -INF, INF, false,
+                                        nullptr, true, true, true, true,
+                                        true, true);
+    sta->report()->redirectStringBegin();
+    sta->reportPathEnds(&ends);
+    sta->report()->redirectStringEnd();
+  });
+
+  // Repeat the analysis from scratch with the graph and parasitics in
+  // place to time the incremental update paths.
+  runStep("incr_delay_calc", iterations, results, [&] () {
+    sta->delaysInvalid();
+    sta->findDelays();
+  });
+  runStep("incr_search", iterations, results, [&] () {
+    sta->arrivalsInvalid();
+    sta->updateTiming(false);
+    sta->findRequireds();
+  });
+}
+
+static void
+writeResults(FILE *stream,
+             Sta *sta,
+             const BenchDesign &design,
+             int thread_count,
+             const BenchResultSeq &results)
+{
+  Network *network = sta->network();
+  Graph *graph = sta->graph();
+  fprintf(stream, "{\n");
+  fprintf(stream, "  \"version\": \"%s\",\n", STA_VERSION);
+  fprintf(stream, "  \"git_sha1\": \"%s\",\n", STA_GIT_SHA1);
+  fprintf(stream, "  \"threads\": %d,\n", thread_count);
+  fprintf(stream, "  \"design\": {\n");
+  fprintf(stream, "    \"depth\": %d,\n", design.depth);
+  fprintf(stream, "    \"registers\": %d,\n", design.registers);
+  fprintf(stream, "    \"fanout\": %d,\n", design.fanout);
+  fprintf(stream, "    \"clocks\": %d,\n", design.clocks);
+  fprintf(stream, "    \"exceptions\": %d,\n", design.exceptions);
+  fprintf(stream, "    \"instances\": %d,\n", network->leafInstanceCount());
+  fprintf(stream, "    \"vertices\": %u,\n", graph ? graph->vertexCount() : 0u);
+  fprintf(stream, "    \"edges\": %d\n", graph ? graph->edgeCount() : 0);
+  fprintf(stream, "  },\n");
+  fprintf(stream, "  \"benchmarks\": {\n");
+  for (size_t i = 0; i < results.size(); i++) {
+    const BenchResult &result = results[i];
+    fprintf(stream, "    \"%s\": {\"iterations\": %d, \"elapsed\": %.6f, \"elapsed_mean\": %.6f, \"user\": %.6f, \"memory\": %ld}%s\n",
+            result.name.c_str(),
+            result.iterations,
+            result.elapsed,
+            result.elapsed_mean,
+            result.user,
+            result.memory,
+            (i + 1 < results.size()) ? "," : "");
+  }
+  fprintf(stream, "  },\n");
+  fprintf(stream, "  \"peak_memory\": %zu\n", peakMemoryUsage());
+  fprintf(stream, "}\n");
+}
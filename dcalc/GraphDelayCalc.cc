@@ -137,6 +137,19 @@ GraphDelayCalc::delaysInvalid()
   invalid_latch_edges_.clear();
 }
 
+void
+GraphDelayCalc::delaysRestored()
+{
+  debugPrint(debug_, "delay_calc", 1, "delays restored");
+  delays_exist_ = true;
+  delays_seeded_ = true;
+  incremental_ = true;
+  iter_->clear();
+  invalid_delays_->clear();
+  invalid_check_edges_.clear();
+  invalid_latch_edges_.clear();
+}
+
 void
 GraphDelayCalc::delayInvalid(const Pin *pin)
 {
@@ -910,6 +923,7 @@ GraphDelayCalc::findDriverArcDelays(Vertex *drvr_vertex,
       ArcDcalcResultSeq dcalc_results =
         arc_delay_calc->gateDelays(dcalc_args, load_cap, load_pin_index_map,
                                    dcalc_ap);
+      Stats::incrCount(StatsCount::arc_delay_calcs);
       for (size_t drvr_idx = 0; drvr_idx < dcalc_args.size(); drvr_idx++) {
         ArcDcalcArg &dcalc_arg = dcalc_args[drvr_idx];
         ArcDcalcResult &dcalc_result = dcalc_results[drvr_idx];
@@ -925,6 +939,7 @@ GraphDelayCalc::findDriverArcDelays(Vertex *drvr_vertex,
                                                               load_cap, parasitic,
                                                               load_pin_index_map,
                                                               dcalc_ap);
+      Stats::incrCount(StatsCount::arc_delay_calcs);
       delay_changed |= annotateDelaysSlews(edge, arc, dcalc_result,
                                            load_pin_index_map, dcalc_ap);
     }
@@ -1431,6 +1446,7 @@ GraphDelayCalc::findCheckEdgeDelays(Edge *edge,
           ArcDelay check_delay = arc_delay_calc->checkDelay(to_pin, arc, from_slew,
                                                             to_slew, related_out_cap,
                                                             dcalc_ap);
+          Stats::incrCount(StatsCount::arc_delay_calcs);
 	  debugPrint(debug_, "delay_calc", 3,
                      "    check_delay = %s",
                      delayAsString(check_delay, this));
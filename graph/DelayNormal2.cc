@@ -36,154 +36,76 @@ square(float x)
   return x * x;
 }
 
-static Delay delay_init_values[MinMax::index_count];
-
-void
-initDelayConstants()
-{
-  delay_init_values[MinMax::minIndex()] = MinMax::min()->initValue();
-  delay_init_values[MinMax::maxIndex()] = MinMax::max()->initValue();
-}
-
-const Delay &
-delayInitValue(const MinMax *min_max)
-{
-  return delay_init_values[min_max->index()];
-}
-
-Delay::Delay() :
-  mean_(0.0),
-  sigma2_{0.0, 0.0}
-{
-}
-
-Delay::Delay(const Delay &delay) :
-  mean_(delay.mean_)
-{
-  sigma2_[EarlyLate::earlyIndex()] = delay.sigma2_[EarlyLate::earlyIndex()];
-  sigma2_[EarlyLate::lateIndex()] = delay.sigma2_[EarlyLate::lateIndex()];
-}
-
-Delay::Delay(float mean) :
-  mean_(mean),
-  sigma2_{0.0, 0.0}
-{
-}
-
-Delay::Delay(float mean,
-	     float sigma2_early,
-	     float sigma2_late) :
-  mean_(mean),
-  sigma2_{sigma2_early, sigma2_late}
-{
-}
-
-float
-Delay::sigma(const EarlyLate *early_late) const
-{
-  float sigma = sigma2_[early_late->index()];
-  if (sigma < 0.0)
-    // Sigma is negative for crpr to offset sigmas in the common
-    // clock path.
-    return -sqrt(-sigma);
+// Sigma from sigma^2 using the single precision sqrt.
+// Sigma^2 is negative for crpr to offset sigmas in the common
+// clock path.
+static inline float
+sigma2Sqrt(float sigma2)
+{
+  if (sigma2 == 0.0)
+    return 0.0;
+  else if (sigma2 < 0.0)
+    return -std::sqrt(-sigma2);
   else
-    return sqrt(sigma);
-}
-
-float
-Delay::sigma2(const EarlyLate *early_late) const
-{
-  return sigma2_[early_late->index()];
+    return std::sqrt(sigma2);
 }
 
-float
-Delay::sigma2Early() const
+// mean - sigma * sigma_factor
+static inline float
+delayEarly(const Delay &delay,
+	   float sigma_factor)
 {
-  return sigma2_[early_index];
+  return delay.mean() - sigma2Sqrt(delay.sigma2Early()) * sigma_factor;
 }
 
-float
-Delay::sigma2Late() const
+// mean + sigma * sigma_factor
+static inline float
+delayLate(const Delay &delay,
+	  float sigma_factor)
 {
-  return sigma2_[late_index];
+  return delay.mean() + sigma2Sqrt(delay.sigma2Late()) * sigma_factor;
 }
 
-void
-Delay::operator=(const Delay &delay)
+// The comparisons only need the early or late bound of each delay, so
+// look up the pocv mode and sigma factor once per compare instead of
+// going through delayAsFloat for each argument.
+static inline float
+delayEarly(const Delay &delay,
+	   const StaState *sta)
 {
-  mean_ = delay.mean_;
-  sigma2_[early_index] = delay.sigma2_[early_index];
-  sigma2_[late_index] = delay.sigma2_[late_index];
+  return sta->pocvEnabled()
+    ? delayEarly(delay, sta->sigmaFactor())
+    : delay.mean();
 }
 
-void
-Delay::operator=(float delay)
+static inline float
+delayLate(const Delay &delay,
+	  const StaState *sta)
 {
-  mean_ = delay;
-  sigma2_[early_index] = 0.0;
-  sigma2_[late_index] = 0.0;
+  return sta->pocvEnabled()
+    ? delayLate(delay, sta->sigmaFactor())
+    : delay.mean();
 }
 
-void
-Delay::operator+=(const Delay &delay)
-{
-  mean_ += delay.mean_;
-  sigma2_[early_index] += delay.sigma2_[early_index];
-  sigma2_[late_index] += delay.sigma2_[late_index];
-}
+static Delay delay_init_values[MinMax::index_count];
 
 void
-Delay::operator+=(float delay)
-{
-  mean_ += delay;
-}
-
-Delay
-Delay::operator+(const Delay &delay) const
-{
-  return Delay(mean_ + delay.mean_,
-	       sigma2_[early_index] + delay.sigma2_[early_index],
-	       sigma2_[late_index] + delay.sigma2_[late_index]);
-}
-
-Delay
-Delay::operator+(float delay) const
-{
-  return Delay(mean_ + delay, sigma2_[early_index], sigma2_[late_index]);
-}
-
-Delay
-Delay::operator-(const Delay &delay) const
-{
-  return Delay(mean_ - delay.mean_,
-	       sigma2_[early_index] + delay.sigma2_[late_index],
-	       sigma2_[late_index] + delay.sigma2_[early_index]);
-}
-
-Delay
-Delay::operator-(float delay) const
-{
-  return Delay(mean_ - delay, sigma2_[early_index], sigma2_[late_index]);
-}
-
-Delay
-Delay::operator-() const
+initDelayConstants()
 {
-  return Delay(-mean_, sigma2_[late_index], sigma2_[early_index]);
+  delay_init_values[MinMax::minIndex()] = MinMax::min()->initValue();
+  delay_init_values[MinMax::maxIndex()] = MinMax::max()->initValue();
 }
 
-void
-Delay::operator-=(float delay)
+const Delay &
+delayInitValue(const MinMax *min_max)
 {
-  mean_ -= delay;
+  return delay_init_values[min_max->index()];
 }
 
-void
-Delay::operator-=(const Delay &delay)
+float
+Delay::sigma(const EarlyLate *early_late) const
 {
-  mean_ -= delay.mean_;
-  sigma2_[early_index] += delay.sigma2_[early_index];
-  sigma2_[late_index] += delay.sigma2_[late_index];
+  return sigma2Sqrt(sigma2_[early_late->index()]);
 }
 
 bool
@@ -249,8 +171,8 @@ delayLess(const Delay &delay1,
 	  const Delay &delay2,
 	  const StaState *sta)
 {
-  return fuzzyLess(delayAsFloat(delay1, EarlyLate::early(), sta),
-		   delayAsFloat(delay2, EarlyLate::early(), sta));
+  return fuzzyLess(delayEarly(delay1, sta),
+		   delayEarly(delay2, sta));
 }
 
 bool
@@ -258,7 +180,7 @@ delayLess(const Delay &delay1,
 	  float delay2,
 	  const StaState *sta)
 {
-  return fuzzyLess(delayAsFloat(delay1, EarlyLate::early(), sta),
+  return fuzzyLess(delayEarly(delay1, sta),
 		   delay2);
 }
 
@@ -279,8 +201,8 @@ delayLessEqual(const Delay &delay1,
 	       const Delay &delay2,
 	       const StaState *sta)
 {
-  return fuzzyLessEqual(delayAsFloat(delay1, EarlyLate::early(), sta),
-			delayAsFloat(delay2, EarlyLate::early(), sta));
+  return fuzzyLessEqual(delayEarly(delay1, sta),
+			delayEarly(delay2, sta));
 }
 
 bool
@@ -288,7 +210,7 @@ delayLessEqual(const Delay &delay1,
 	       float delay2,
 	       const StaState *sta)
 {
-  return fuzzyLessEqual(delayAsFloat(delay1, EarlyLate::early(), sta),
+  return fuzzyLessEqual(delayEarly(delay1, sta),
 			delay2);
 }
 
@@ -309,8 +231,8 @@ delayGreater(const Delay &delay1,
 	     const Delay &delay2,
 	     const StaState *sta)
 {
-  return fuzzyGreater(delayAsFloat(delay1, EarlyLate::late(), sta),
-		      delayAsFloat(delay2, EarlyLate::late(), sta));
+  return fuzzyGreater(delayLate(delay1, sta),
+		      delayLate(delay2, sta));
 }
 
 bool
@@ -318,8 +240,8 @@ delayGreater(const Delay &delay1,
 	     float delay2,
 	     const StaState *sta)
 {
-  return fuzzyGreaterEqual(delayAsFloat(delay1, EarlyLate::late(), sta),
-			   delayAsFloat(delay2, EarlyLate::late(), sta));
+  return fuzzyGreaterEqual(delayLate(delay1, sta),
+			   delay2);
 }
 
 bool
@@ -327,8 +249,8 @@ delayGreaterEqual(const Delay &delay1,
 		  const Delay &delay2,
 		  const StaState *sta)
 {
-  return fuzzyGreaterEqual(delayAsFloat(delay1, EarlyLate::late(), sta),
-			   delayAsFloat(delay2, EarlyLate::late(), sta));
+  return fuzzyGreaterEqual(delayLate(delay1, sta),
+			   delayLate(delay2, sta));
 }
 
 bool
@@ -336,7 +258,7 @@ delayGreaterEqual(const Delay &delay1,
 		  float delay2,
 		  const StaState *sta)
 {
-  return fuzzyGreaterEqual(delayAsFloat(delay1, EarlyLate::late(), sta),
+  return fuzzyGreaterEqual(delayLate(delay1, sta),
 			   delay2);
 }
 
@@ -371,9 +293,9 @@ delayAsFloat(const Delay &delay,
 {
   if (sta->pocvEnabled()) {
     if (early_late == EarlyLate::early())
-      return delay.mean() - delay.sigma(early_late) * sta->sigmaFactor();
+      return delayEarly(delay, sta->sigmaFactor());
     else if (early_late == EarlyLate::late())
-      return delay.mean() + delay.sigma(early_late) * sta->sigmaFactor();
+      return delayLate(delay, sta->sigmaFactor());
     else
       sta->report()->critical(1030, "unknown early/late value.");
   }
@@ -438,15 +360,6 @@ delayRatio(const Delay &delay1,
   return delay1.mean() / delay2.mean();
 }
 
-Delay
-operator+(float delay1,
-	  const Delay &delay2)
-{
-  return Delay(delay1 + delay2.mean(),
-	       delay2.sigma2Early(),
-	       delay2.sigma2Late());
-}
-
 Delay
 operator/(float delay1,
 	  const Delay &delay2)
@@ -1121,6 +1121,7 @@ Vertex::init(Pin *pin,
   bfs_in_queue_ = 0;
   crpr_path_pruning_disabled_ = false;
   requireds_pruned_ = false;
+  shared_requireds_ = false;
 }
 
 void
@@ -1219,6 +1220,12 @@ Vertex::setRequiredsPruned(bool pruned)
   requireds_pruned_ = pruned;
 }
 
+void
+Vertex::setSharedRequireds(bool shared)
+{
+  shared_requireds_ = shared;
+}
+
 TagGroupIndex
 Vertex::tagGroupIndex() const
 {
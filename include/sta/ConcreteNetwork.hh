@@ -21,6 +21,7 @@
 #include "Map.hh"
 #include "Set.hh"
 #include "StringUtil.hh"
+#include "ObjectTable.hh"
 #include "Network.hh"
 #include "LibertyClass.hh"
 
@@ -48,6 +49,11 @@ typedef Vector<ConcreteNet*> ConcreteNetSeq;
 typedef Vector<ConcretePin*> ConcretePinSeq;
 typedef Map<Cell*, Instance*> CellNetworkViewMap;
 typedef Set<const ConcreteNet*> ConcreteNetSet;
+// Pins, terminals and nets are allocated in blocks to avoid per object
+// malloc overhead and keep the pins of an instance next to each other.
+typedef ObjectTable<ConcretePin> ConcretePinTable;
+typedef ObjectTable<ConcreteTerm> ConcreteTermTable;
+typedef ObjectTable<ConcreteNet> ConcreteNetTable;
 
 // This adapter implements the network api for the concrete network.
 // A superset of the Network api methods are implemented in the interface.
@@ -119,10 +125,15 @@ public:
   bool isLeaf(const Instance *instance) const override;
   Instance *findChild(const Instance *parent,
                       const char *name) const override;
+  void findChildrenMatching(const Instance *parent,
+                            const PatternMatch *pattern,
+                            InstanceSeq &matches) const override;
   Pin *findPin(const Instance *instance,
                const char *port_name) const override;
   Pin *findPin(const Instance *instance,
                const Port *port) const override;
+  Pin *findPin(const Instance *instance,
+               const LibertyPort *port) const override;
 
   InstanceChildIterator *
   childIterator(const Instance *instance) const override;
@@ -267,6 +278,12 @@ protected:
 			ConcretePin *cpin);
   void connectNetPin(ConcreteNet *cnet,
 		     ConcretePin *cpin);
+  ConcretePin *makeConcretePin(ConcreteInstance *cinst,
+			       ConcretePort *cport,
+			       ConcreteNet *cnet);
+  ConcreteTerm *makeConcreteTerm(ConcretePin *cpin,
+				 ConcreteNet *cnet);
+  void deleteTerm(ConcreteTerm *cterm);
 
   // Cell lookup search order sequence.
   ConcreteLibrarySeq library_seq_;
@@ -275,6 +292,9 @@ protected:
   NetSet constant_nets_[2];  // LogicValue::zero/one
   LinkNetworkFunc *link_func_;
   CellNetworkViewMap cell_network_view_map_;
+  ConcretePinTable pin_table_;
+  ConcreteTermTable term_table_;
+  ConcreteNetTable net_table_;
   static ObjectId object_id_;
 
 private:
@@ -295,6 +315,8 @@ public:
                         NetSeq &matches) const;
   InstanceNetIterator *netIterator() const;
   Instance *findChild(const char *name) const;
+  void findChildrenMatching(const PatternMatch *pattern,
+                            InstanceSeq &matches) const;
   InstanceChildIterator *childIterator() const;
   void setAttribute(const string &key,
                     const string &value);
@@ -334,6 +356,7 @@ private:
 class ConcretePin
 {
 public:
+  ConcretePin();
   const char *name() const;
   ConcreteInstance *instance() const { return instance_; }
   ConcreteNet *net() const { return net_; }
@@ -342,18 +365,20 @@ public:
   ObjectId id() const { return id_; }
   VertexId vertexId() const { return vertex_id_; }
   void setVertexId(VertexId id);
+  ObjectIdx objectIdx() const { return object_idx_; }
+  void setObjectIdx(ObjectIdx idx);
 
 protected:
-  ~ConcretePin() {}
-  ConcretePin(ConcreteInstance *instance,
-	      ConcretePort *port,
-	      ConcreteNet *net);
+  void init(ConcreteInstance *instance,
+	    ConcretePort *port,
+	    ConcreteNet *net);
 
   ConcreteInstance *instance_;
   ConcretePort *port_;
   ConcreteNet *net_;
   ConcreteTerm *term_;
   ObjectId id_;
+  unsigned object_idx_:ConcretePinTable::idx_bits;
   // Doubly linked list of net pins.
   ConcretePin *net_next_;
   ConcretePin *net_prev_;
@@ -368,19 +393,22 @@ private:
 class ConcreteTerm
 {
 public:
+  ConcreteTerm();
   const char *name() const;
   ObjectId id() const { return id_; }
   ConcreteNet *net() const { return net_; }
   ConcretePin *pin() const { return pin_; }
+  ObjectIdx objectIdx() const { return object_idx_; }
+  void setObjectIdx(ObjectIdx idx);
 
 protected:
-  ~ConcreteTerm() {}
-  ConcreteTerm(ConcretePin *pin,
-	       ConcreteNet *net);
+  void init(ConcretePin *pin,
+	    ConcreteNet *net);
 
   ConcretePin *pin_;
   ConcreteNet *net_;
   ObjectId id_;
+  unsigned object_idx_:ConcreteTermTable::idx_bits;
   // Linked list of net terms.
   ConcreteTerm *net_next_;
 
@@ -393,6 +421,7 @@ private:
 class ConcreteNet
 {
 public:
+  ConcreteNet();
   const char *name() const { return name_; }
   ObjectId id() const { return id_; }
   ConcreteInstance *instance() const { return instance_; }
@@ -402,13 +431,19 @@ public:
   void deleteTerm(ConcreteTerm *term);
   void mergeInto(ConcreteNet *net);
   ConcreteNet *mergedInto() { return merged_into_; }
+  ObjectIdx objectIdx() const { return object_idx_; }
+  void setObjectIdx(ObjectIdx idx);
 
 protected:
-  ConcreteNet(const char *name,
-	      ConcreteInstance *instance);
-  ~ConcreteNet();
+  void init(const char *name,
+	    ConcreteInstance *instance);
+  // The name is not deleted by the destructor because the net table
+  // destroys free objects when its blocks are deleted.
+  void deleteName();
+
   const char *name_;
   ObjectId id_;
+  unsigned object_idx_:ConcreteNetTable::idx_bits;
   ConcreteInstance *instance_;
   // Pointer to head of linked list of pins.
   ConcretePin *pins_;
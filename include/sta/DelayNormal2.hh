@@ -24,6 +24,9 @@ class Delay;
 class StaState;
 
 // Normal distribution with early(left)/late(right) std deviations.
+// Vertex arrival/required arrays hold Delay objects (mean and sigma^2
+// interleaved) like every other delay model, so there is no separate
+// mean/sigma array layout for POCV builds.
 class Delay
 {
 public:
@@ -62,6 +65,136 @@ private:
   float sigma2_[EarlyLate::index_count];
 };
 
+// The arithmetic operators are inline so the mean/sigma updates in the
+// arrival and required loops compile down to a few float operations
+// instead of out of line calls.
+
+inline
+Delay::Delay() :
+  mean_(0.0),
+  sigma2_{0.0, 0.0}
+{
+}
+
+inline
+Delay::Delay(const Delay &delay) :
+  mean_(delay.mean_),
+  sigma2_{delay.sigma2_[early_index], delay.sigma2_[late_index]}
+{
+}
+
+inline
+Delay::Delay(float mean) :
+  mean_(mean),
+  sigma2_{0.0, 0.0}
+{
+}
+
+inline
+Delay::Delay(float mean,
+	     float sigma2_early,
+	     float sigma2_late) :
+  mean_(mean),
+  sigma2_{sigma2_early, sigma2_late}
+{
+}
+
+inline float
+Delay::sigma2(const EarlyLate *early_late) const
+{
+  return sigma2_[early_late->index()];
+}
+
+inline float
+Delay::sigma2Early() const
+{
+  return sigma2_[early_index];
+}
+
+inline float
+Delay::sigma2Late() const
+{
+  return sigma2_[late_index];
+}
+
+inline void
+Delay::operator=(const Delay &delay)
+{
+  mean_ = delay.mean_;
+  sigma2_[early_index] = delay.sigma2_[early_index];
+  sigma2_[late_index] = delay.sigma2_[late_index];
+}
+
+inline void
+Delay::operator=(float delay)
+{
+  mean_ = delay;
+  sigma2_[early_index] = 0.0;
+  sigma2_[late_index] = 0.0;
+}
+
+inline void
+Delay::operator+=(const Delay &delay)
+{
+  mean_ += delay.mean_;
+  sigma2_[early_index] += delay.sigma2_[early_index];
+  sigma2_[late_index] += delay.sigma2_[late_index];
+}
+
+inline void
+Delay::operator+=(float delay)
+{
+  mean_ += delay;
+}
+
+inline Delay
+Delay::operator+(const Delay &delay) const
+{
+  return Delay(mean_ + delay.mean_,
+	       sigma2_[early_index] + delay.sigma2_[early_index],
+	       sigma2_[late_index] + delay.sigma2_[late_index]);
+}
+
+inline Delay
+Delay::operator+(float delay) const
+{
+  return Delay(mean_ + delay, sigma2_[early_index], sigma2_[late_index]);
+}
+
+inline Delay
+Delay::operator-(const Delay &delay) const
+{
+  return Delay(mean_ - delay.mean_,
+	       sigma2_[early_index] + delay.sigma2_[late_index],
+	       sigma2_[late_index] + delay.sigma2_[early_index]);
+}
+
+inline Delay
+Delay::operator-(float delay) const
+{
+  return Delay(mean_ - delay, sigma2_[early_index], sigma2_[late_index]);
+}
+
+inline Delay
+Delay::operator-() const
+{
+  return Delay(-mean_, sigma2_[late_index], sigma2_[early_index]);
+}
+
+inline void
+Delay::operator-=(float delay)
+{
+  mean_ -= delay;
+}
+
+inline void
+Delay::operator-=(const Delay &delay)
+{
+  mean_ -= delay.mean_;
+  sigma2_[early_index] += delay.sigma2_[early_index];
+  sigma2_[late_index] += delay.sigma2_[late_index];
+}
+
 const Delay delay_zero(0.0);
 
 void
@@ -165,8 +298,15 @@ delayRatio(const Delay &delay1,
 // functions so they can be defined on floats, where there is no class
 // to define them.
 
-Delay operator+(float delay1,
-		const Delay &delay2);
+inline Delay
+operator+(float delay1,
+	  const Delay &delay2)
+{
+  return Delay(delay1 + delay2.mean(),
+	       delay2.sigma2Early(),
+	       delay2.sigma2Late());
+}
+
 // Used for parallel gate delay calc.
 Delay operator/(float delay1,
 		const Delay &delay2);
@@ -38,6 +38,7 @@ public:
 
 private:
   void dispatch_thread_handler(size_t i);
+  void startThreads(size_t thread_count);
   void terminateThreads();
 
   std::mutex lock_;
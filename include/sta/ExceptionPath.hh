@@ -341,6 +341,10 @@ public:
 				   Network *network) = 0;
 
 protected:
+  // Scramble object ids before they are summed into hash_ so that
+  // different sets of objects with nearby ids do not collide.
+  static size_t idHash(size_t id);
+
   const RiseFallBoth *rf_;
   // True when the pin/net/inst/edge sets are owned by the exception point.
   bool own_pts_;
@@ -16,12 +16,16 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "Set.hh"
 #include "NetworkClass.hh"
 #include "LibertyClass.hh"
 
 namespace sta {
 
+class FuncTruthTable;
+
 class FuncExpr
 {
 public:
@@ -38,6 +42,7 @@ public:
 	   FuncExpr *left,
 	   FuncExpr *right,
 	   LibertyPort *port);
+  ~FuncExpr();
   static FuncExpr *makePort(LibertyPort *port);
   static FuncExpr *makeNot(FuncExpr *expr);
   static FuncExpr *makeAnd(FuncExpr *left,
@@ -74,6 +79,11 @@ public:
   // Return true if there is a mismatch.
   bool checkSize(size_t size);
   bool checkSize(LibertyPort *port);
+  // Compile the expression into a truth table if it is an operator
+  // with at most FuncTruthTable::max_inputs input ports.
+  void makeTruthTable();
+  // nullptr if the expression does not have a truth table.
+  const FuncTruthTable *truthTable() const { return truth_table_; }
 
 private:
   const char *asString(bool with_parens) const;
@@ -84,6 +94,38 @@ private:
   FuncExpr *left_;
   FuncExpr *right_;
   LibertyPort *port_;
+  FuncTruthTable *truth_table_;
+};
+
+// Truth table of a function of up to max_inputs ports packed into
+// a 64 bit word. Bit m of the table is the function value when the
+// value of input(i) is bit i of m.
+class FuncTruthTable
+{
+public:
+  static const size_t max_inputs = 6;
+
+  FuncTruthTable(const LibertyPortSeq &inputs,
+		 uint64_t table);
+  size_t inputCount() const { return input_count_; }
+  LibertyPort *input(size_t index) const { return inputs_[index]; }
+  // Index of port in the inputs, -1 if the function does not use it.
+  int inputIndex(const LibertyPort *port) const;
+  uint64_t table() const { return table_; }
+  // Minterms where flipping input(index) changes the function value
+  // (the boolean difference of the function wrt the input).
+  uint64_t sensitivity(size_t index) const { return sensitivity_[index]; }
+  // Minterms of all input values.
+  uint64_t mintermMask() const;
+  size_t mintermCount() const { return size_t(1) << input_count_; }
+  // Minterms where input(index) is one.
+  static uint64_t inputMask(size_t index);
+
+private:
+  LibertyPort *inputs_[max_inputs];
+  size_t input_count_;
+  uint64_t table_;
+  uint64_t sensitivity_[max_inputs];
 };
 
 // Negate an expression.
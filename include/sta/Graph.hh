@@ -329,6 +329,9 @@ public:
   void setCrprPathPruningDisabled(bool disabled);
   bool requiredsPruned() const { return requireds_pruned_; }
   void setRequiredsPruned(bool pruned);
+  // Requireds use the TagGroup shared required layout.
+  bool sharedRequireds() const { return shared_requireds_; }
+  void setSharedRequireds(bool shared);
   
   // ObjectTable interface.
   ObjectIdx objectIdx() const { return object_idx_; }
@@ -379,6 +382,7 @@ protected:
   bool has_downstream_clk_pin_:1;
   bool crpr_path_pruning_disabled_:1;
   bool requireds_pruned_:1;
+  bool shared_requireds_:1;
 
   unsigned object_idx_:VertexTable::idx_bits;
 
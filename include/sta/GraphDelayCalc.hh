@@ -52,6 +52,9 @@ public:
   virtual void setObserver(DelayCalcObserver *observer);
   // Invalidate all delays/slews.
   virtual void delaysInvalid();
+  // Delays/slews were restored on the graph (read_checkpoint).
+  // Later edits update them incrementally.
+  virtual void delaysRestored();
   // Invalidate vertex and downstream delays/slews.
   virtual void delayInvalid(Vertex *vertex);
   virtual void delayInvalid(const Pin *pin);
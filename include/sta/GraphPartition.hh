@@ -0,0 +1,67 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2024, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <vector>
+
+#include "GraphClass.hh"
+#include "StaState.hh"
+
+namespace sta {
+
+// Partition the timing graph into regions to estimate how a design
+// would divide for timing in separate processes. This is a diagnostic;
+// nothing is timed by partition. Vertices are clustered by fanout cone
+// from the startpoints and the clusters are cut into partition_count
+// partitions balanced by vertex count. Edges between partitions are the
+// boundary whose arrivals and slews would have to be exchanged between
+// regions.
+class GraphPartition : public StaState
+{
+public:
+  GraphPartition(int partition_count,
+                 const StaState *sta);
+  void partitionGraph();
+  int partitionCount() const { return partition_count_; }
+  // Partition index of vertex, or -1 if it was not partitioned.
+  int partition(const Vertex *vertex) const;
+  size_t vertexCount(int partition) const;
+  // Edges into partition from other partitions.
+  size_t boundaryInEdgeCount(int partition) const;
+  // Vertices in partition with fanout to other partitions.
+  size_t boundaryOutVertexCount(int partition) const;
+  void report() const;
+
+protected:
+  bool isStart(Vertex *vertex) const;
+  void visitFanout(Vertex *start);
+  void assignPartition(Vertex *vertex);
+  void findBoundaries();
+
+  int partition_count_;
+  // Maximum vertices in a partition.
+  size_t partition_size_;
+  int current_partition_;
+  // Indexed by VertexId.
+  std::vector<int> vertex_partitions_;
+  // Indexed by partition.
+  std::vector<size_t> vertex_counts_;
+  std::vector<size_t> boundary_in_edge_counts_;
+  std::vector<size_t> boundary_out_vertex_counts_;
+};
+
+} // namespace
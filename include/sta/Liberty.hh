@@ -549,6 +549,7 @@ protected:
 			       TimingArcSet *setup_check,
 			       Debug *debug);
   void findDefaultCondArcs();
+  void makeFuncTruthTables();
   void translatePresetClrCheckRoles();
   void inferLatchRoles(Debug *debug);
   void deleteInternalPowerAttrs();
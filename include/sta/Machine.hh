@@ -91,4 +91,8 @@ systemRunTime();
 size_t
 memoryUsage();
 
+// Peak memory usage in bytes.
+size_t
+peakMemoryUsage();
+
 } // namespace sta
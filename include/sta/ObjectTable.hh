@@ -176,6 +176,7 @@ ObjectTable<TYPE>::clear()
 {
   blocks_.deleteContentsClear();
   size_ = 0;
+  free_ = object_id_null;
 }
 
 ////////////////////////////////////////////////////////////////
@@ -137,7 +137,8 @@ private:
   const RiseFall *rf_;
   const PathAnalysisPt *path_ap_;
   const MinMax *min_max_;
-  ArrivalMap::Iterator arrival_iter_;
+  TagGroup *tag_group_;
+  int arrival_index_;
   PathVertex path_;
   PathVertex next_;
 };
@@ -55,6 +55,10 @@ public:
   bool nocase() const { return nocase_; }
   Tcl_Interp *tclInterp() const { return interp_; }
   bool hasWildcards() const;
+  // Length of the leading part of the pattern that contains no
+  // wildcards. Every string matched by the pattern begins with it.
+  // Zero for regular expressions and case insensitive patterns.
+  size_t literalPrefixLength() const;
 
 private:
   void compileRegexp();
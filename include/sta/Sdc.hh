@@ -119,14 +119,14 @@ typedef Map<const Pin*, InputDelaySet*, PinIdLess> InputDelaysPinMap;
 typedef Set<OutputDelay*> OutputDelaySet;
 typedef Map<const Pin*,OutputDelaySet*, PinIdLess> OutputDelaysPinMap;
 typedef UnorderedMap<const Pin*,ExceptionPathSet*> PinExceptionsMap;
-typedef Map<const Clock*,ExceptionPathSet*> ClockExceptionsMap;
-typedef Map<const Instance*,ExceptionPathSet*> InstanceExceptionsMap;
-typedef Map<const Net*,ExceptionPathSet*> NetExceptionsMap;
+typedef UnorderedMap<const Clock*,ExceptionPathSet*> ClockExceptionsMap;
+typedef UnorderedMap<const Instance*,ExceptionPathSet*> InstanceExceptionsMap;
+typedef UnorderedMap<const Net*,ExceptionPathSet*> NetExceptionsMap;
 typedef UnorderedMap<EdgePins, ExceptionPathSet*,
 		     PinPairHash, PinPairEqual> EdgeExceptionsMap;
 typedef Vector<ExceptionThru*> ExceptionThruSeq;
 typedef Map<const Port*,InputDrive*> InputDriveMap;
-typedef Map<int, ExceptionPathSet*, std::less<int> > ExceptionPathPtHash;
+typedef UnorderedMap<size_t, ExceptionPathSet*> ExceptionPathPtHash;
 typedef Set<ClockLatency*, ClockLatencyLess> ClockLatencies;
 typedef Map<const Pin*, ClockUncertainties*> PinClockUncertaintyMap;
 typedef Set<InterClockUncertainty*, InterClockUncertaintyLess> InterClockUncertaintySet;
@@ -78,6 +78,12 @@ public:
   // disables additional search to returns approximate required times.
   bool crprApproxMissingRequireds() const;
   void setCrprApproxMissingRequireds(bool enabled);
+  // When enabled, paths with the same clock and path analysis point
+  // share one required time (the worst) at vertices that are not
+  // endpoints to reduce memory. Endpoint paths only share requireds
+  // when they differ by crpr clock pin. See TagGroup::requiredCount.
+  bool requiredsWorstPerClk() const { return requireds_worst_per_clk_; }
+  void setRequiredsWorstPerClk(bool enabled);
 
   bool unconstrainedPaths() const { return unconstrained_paths_; }
   // from/thrus/to are owned and deleted by Search.
@@ -330,6 +336,16 @@ public:
   void reportArrivals(Vertex *vertex) const;
   Slack wnsSlack(Vertex *vertex,
 		 PathAPIndex path_ap_index);
+  // Worst slack for each path analysis point of each vertex.
+  // Vertices are processed in parallel.
+  void wnsSlacks(const VertexSeq &vertices,
+		 // Return values.
+		 Vector<SlackSeq> &slacks);
+  // Worst slack for one path analysis point of each vertex.
+  void wnsSlacks(const VertexSeq &vertices,
+		 PathAPIndex path_ap_index,
+		 // Return values.
+		 SlackSeq &slacks);
   void levelChangedBefore(Vertex *vertex);
   void seedInputArrival(const Pin *pin,
  			Vertex *vertex,
@@ -539,6 +555,7 @@ protected:
   bool unconstrained_paths_;
   bool crpr_path_pruning_enabled_;
   bool crpr_approx_missing_requireds_;
+  bool requireds_worst_per_clk_;
   // Search predicates.
   SearchPred *search_adj_;
   SearchPred *search_clk_;
@@ -765,6 +782,12 @@ public:
   Required required(int arrival_index);
 
 protected:
+  int requiredIndex(int arrival_index) const;
+
+  TagGroup *tag_group_;
+  // Use the TagGroup shared required layout (not an endpoint).
+  bool shared_requireds_;
+  // Indexed by TagGroup::requiredIndex.
   ArrivalSeq requireds_;
   bool have_requireds_;
 };
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <limits>
+#include <utility>
 
 #include "Vector.hh"
 #include "Set.hh"
@@ -112,11 +113,13 @@ typedef StringSet PathGroupNameSet;
 typedef Vector<PathEnd*> PathEndSeq;
 typedef Vector<Arrival> ArrivalSeq;
 typedef Map<Vertex*, int> VertexPathCountMap;
-typedef UnorderedMap<Tag*, int, TagMatchHash, TagMatchEqual> ArrivalMap;
 typedef Vector<PathVertex> PathVertexSeq;
 typedef Vector<Slack> SlackSeq;
 typedef Delay Crpr;
 typedef Vector<PathRef> PathRefSeq;
+// Limit check pin and its slack.
+typedef std::pair<const Pin*, float> PinSlack;
+typedef Vector<PinSlack> PinSlackSeq;
 
 enum class ReportPathFormat { full,
 			      full_clock,
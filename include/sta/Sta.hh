@@ -108,6 +108,12 @@ public:
 				      Corner *corner,
 				      const MinMaxAll *min_max,
 				      bool infer_latches);
+  // Only build the cells named in cell_names.
+  LibertyLibrary *readLiberty(const char *filename,
+			      Corner *corner,
+			      const MinMaxAll *min_max,
+			      bool infer_latches,
+			      const StringSet *cell_names);
   bool setMinLibrary(const char *min_filename,
 		     const char *max_filename);
   // Network readers call this to notify the Sta to delete any previously
@@ -791,6 +797,11 @@ public:
   // TCL variable sta_crpr_mode.
   CrprMode crprMode() const;
   void setCrprMode(CrprMode mode);
+  // TCL variable sta_requireds_worst_per_clk.
+  // Store one required time per clock and path analysis point at
+  // vertices that are not endpoints to reduce memory.
+  bool requiredsWorstPerClk() const;
+  void setRequiredsWorstPerClk(bool enabled);
   // TCL variable sta_pocv_enabled.
   // Parametric on chip variation (statisical sta).
   bool pocvEnabled() const;
@@ -1095,6 +1106,7 @@ public:
   TagGroupIndex tagGroupCount() const;
   int clkInfoCount() const;
   int arrivalCount() const;
+  // Number of required times stored in the graph.
   int requiredCount() const;
   int vertexArrivalCount(Vertex  *vertex) const;
   Vertex *maxArrivalCountVertex() const;
@@ -1327,7 +1339,8 @@ protected:
   LibertyLibrary *readLibertyFile(const char *filename,
 				  Corner *corner,
 				  const MinMaxAll *min_max,
-				  bool infer_latches);
+				  bool infer_latches,
+				  const StringSet *cell_names);
   // Allow external Liberty reader to parse forms not used by Sta.
   virtual LibertyLibrary *readLibertyFile(const char *filename,
 					  bool infer_latches);
@@ -17,27 +17,53 @@
 #pragma once
 
 #include <cstddef>  // size_t
+#include <atomic>
 
 namespace sta {
 
 class Debug;
 class Report;
 
+// Event counts collected while profiling.
+enum class StatsCount { vertex_visits, arc_delay_calcs, tags_created, count };
+
 // Show run time and memory statistics if the "stats" debug flag is on.
+// When profiling is on the steps are also recorded with their nesting
+// so they can be written as json or a chrome trace (chrome://tracing).
 class Stats
 {
 public:
   explicit Stats(Debug *debug,
                  Report *report);
+  ~Stats();
   void report(const char *step);
 
+  static bool profiling() { return profiling_.load(std::memory_order_relaxed); }
+  // Clear the recorded steps and counts and start recording.
+  static void profileBegin();
+  static void profileEnd();
+  static void incrCount(StatsCount count)
+  {
+    if (profiling())
+      incrCount1(count);
+  }
+  // Throws FileNotWritable.
+  static void writeProfileJson(const char *filename);
+  static void writeProfileTrace(const char *filename);
+
 private:
+  static void incrCount1(StatsCount count);
+
   double elapsed_begin_;
   double user_begin_;
   double system_begin_;
   size_t memory_begin_;
+  int depth_;
   Debug *debug_;
   Report *report_;
+
+  // Read by the worker threads while the main thread turns it on or off.
+  static std::atomic<bool> profiling_;
 };
 
 } // namespace
@@ -464,6 +464,14 @@ private:
   FloatSeq *values_;
 };
 
+// Table axes are immutable, so tables with the same axis variable and
+// values share one axis. Sharing spans libraries, so the corner
+// libraries of a design keep one copy of their common table indices.
+// Takes ownership of values.
+TableAxisPtr
+makeSharedTableAxis(TableAxisVariable variable,
+		    FloatSeq *values);
+
 ////////////////////////////////////////////////////////////////
 
 class ReceiverModel
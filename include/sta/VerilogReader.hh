@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include "StringSet.hh"
+
 namespace sta {
 
 class NetworkReader;
@@ -28,5 +30,10 @@ readVerilogFile(const char *filename,
 void
 deleteVerilogReader();
 
+// Names of the cells instantiated by the modules that have been read.
+void
+verilogInstCellNames(// Return value.
+		     StringSet &cell_names);
+
 } // namespace sta
 
@@ -0,0 +1,71 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2024, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "SearchClass.hh"
+
+namespace sta {
+
+class StaState;
+
+// Write the path ends and the expanded paths to them as a columnar
+// binary file for analysis outside of the sta.
+//
+// File layout (native byte order).
+//   char[8]  magic "STAPATH1"
+//   uint32   path count
+//   uint32   point count
+//   uint32   string count
+//   strings  uint32 length followed by the characters
+//   path columns, path count entries each
+//     uint32   first point index; the points of a path run to the
+//              first point of the next path
+//     uint32   path end type (string index)
+//     uint32   path group (string index)
+//     uint32   corner (string index)
+//     uint8    min_max (0 min, 1 max)
+//     uint8    endpoint rise_fall (0 rise, 1 fall)
+//     uint32   source clock (string index)
+//     uint8    source clock edge rise_fall
+//     uint32   target clock (string index)
+//     uint8    target clock edge rise_fall
+//     float    source clock offset
+//     float    data arrival
+//     float    required
+//     float    slack
+//     float    margin
+//     float    target clock time
+//     float    clock reconvergence pessimism
+//   point columns, point count entries each, from startpoint to endpoint
+//     uint32   pin (string index)
+//     uint32   timing role of the arc to the pin (string index)
+//     uint8    rise_fall
+//     uint8    flags (bit 0 clock, bit 1 driver)
+//     float    arrival
+//     float    incremental delay
+//     float    slew
+//     float    driver load capacitance (0 for loads)
+// String index 0xffffffff is used for missing strings and rise_fall
+// 2 for missing clock edges. Times are seconds and capacitances are
+// farads.
+// Throws FileNotWritable.
+void
+writeTimingPaths(PathEndSeq *ends,
+                 const char *filename,
+                 StaState *sta);
+
+} // namespace
@@ -75,10 +75,16 @@ FuncExpr::FuncExpr(Operator op,
   op_(op),
   left_(left),
   right_(right),
-  port_(port)
+  port_(port),
+  truth_table_(nullptr)
 {
 }
 
+FuncExpr::~FuncExpr()
+{
+  delete truth_table_;
+}
+
 void
 FuncExpr::deleteSubexprs()
 {
@@ -345,6 +351,136 @@ funcExprNot(FuncExpr *expr)
 
 ////////////////////////////////////////////////////////////////
 
+// Return false if the expression has a missing operand or too many ports.
+static bool
+findTruthTableInputs(const FuncExpr *expr,
+		     // Return value.
+		     LibertyPortSeq &inputs)
+{
+  switch (expr->op()) {
+  case FuncExpr::op_port: {
+    LibertyPort *port = expr->port();
+    if (port == nullptr)
+      return false;
+    for (LibertyPort *input : inputs) {
+      if (input == port)
+	return true;
+    }
+    inputs.push_back(port);
+    return inputs.size() <= FuncTruthTable::max_inputs;
+  }
+  case FuncExpr::op_not:
+    return expr->left()
+      && findTruthTableInputs(expr->left(), inputs);
+  case FuncExpr::op_or:
+  case FuncExpr::op_and:
+  case FuncExpr::op_xor:
+    return expr->left() && expr->right()
+      && findTruthTableInputs(expr->left(), inputs)
+      && findTruthTableInputs(expr->right(), inputs);
+  case FuncExpr::op_one:
+  case FuncExpr::op_zero:
+    return true;
+  }
+  return false;
+}
+
+// Evaluate the expression for all 64 minterms at once.
+static uint64_t
+evalTruthTable(const FuncExpr *expr,
+	       const LibertyPortSeq &inputs)
+{
+  switch (expr->op()) {
+  case FuncExpr::op_port: {
+    LibertyPort *port = expr->port();
+    for (size_t i = 0; i < inputs.size(); i++) {
+      if (inputs[i] == port)
+	return FuncTruthTable::inputMask(i);
+    }
+    return 0;
+  }
+  case FuncExpr::op_not:
+    return ~evalTruthTable(expr->left(), inputs);
+  case FuncExpr::op_or:
+    return evalTruthTable(expr->left(), inputs)
+      | evalTruthTable(expr->right(), inputs);
+  case FuncExpr::op_and:
+    return evalTruthTable(expr->left(), inputs)
+      & evalTruthTable(expr->right(), inputs);
+  case FuncExpr::op_xor:
+    return evalTruthTable(expr->left(), inputs)
+      ^ evalTruthTable(expr->right(), inputs);
+  case FuncExpr::op_one:
+    return ~uint64_t(0);
+  case FuncExpr::op_zero:
+    return 0;
+  }
+  return 0;
+}
+
+void
+FuncExpr::makeTruthTable()
+{
+  // Ports and constants are cheaper to evaluate directly.
+  if (truth_table_ == nullptr
+      && (op_ == op_not || op_ == op_or || op_ == op_and || op_ == op_xor)) {
+    LibertyPortSeq inputs;
+    if (findTruthTableInputs(this, inputs))
+      truth_table_ = new FuncTruthTable(inputs, evalTruthTable(this, inputs));
+  }
+}
+
+FuncTruthTable::FuncTruthTable(const LibertyPortSeq &inputs,
+			       uint64_t table) :
+  input_count_(inputs.size())
+{
+  table_ = table & mintermMask();
+  for (size_t i = 0; i < input_count_; i++) {
+    inputs_[i] = inputs[i];
+    // Swap the minterms with input i zero and one.
+    uint64_t input_mask = inputMask(i);
+    int shift = 1 << i;
+    uint64_t flipped = ((table_ & input_mask) >> shift)
+      | ((table_ & ~input_mask) << shift);
+    sensitivity_[i] = (table_ ^ flipped) & mintermMask();
+  }
+}
+
+int
+FuncTruthTable::inputIndex(const LibertyPort *port) const
+{
+  for (size_t i = 0; i < input_count_; i++) {
+    if (inputs_[i] == port)
+      return i;
+  }
+  return -1;
+}
+
+uint64_t
+FuncTruthTable::mintermMask() const
+{
+  if (input_count_ == max_inputs)
+    return ~uint64_t(0);
+  else
+    return (uint64_t(1) << mintermCount()) - 1;
+}
+
+uint64_t
+FuncTruthTable::inputMask(size_t index)
+{
+  static const uint64_t input_masks[max_inputs] = {
+    0xaaaaaaaaaaaaaaaaULL,
+    0xccccccccccccccccULL,
+    0xf0f0f0f0f0f0f0f0ULL,
+    0xff00ff00ff00ff00ULL,
+    0xffff0000ffff0000ULL,
+    0xffffffff00000000ULL
+  };
+  return input_masks[index];
+}
+
+////////////////////////////////////////////////////////////////
+
 FuncExprPortIterator::FuncExprPortIterator(const FuncExpr *expr)
 {
   findPorts(expr);
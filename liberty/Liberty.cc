@@ -777,6 +777,7 @@ LibertyLibrary::makeCornerMap(LibertyCell *cell1,
       if (link) {
         const TimingArcSeq &arcs1 = arc_set1->arcs();
         const TimingArcSeq &arcs2 = arc_set2->arcs();
+        bool arcs_match = arcs1.size() == arcs2.size();
         auto arc_itr1 = arcs1.begin(), arc_itr2 = arcs2.begin();
         for (;
              arc_itr1 != arcs1.end() && arc_itr2 != arcs2.end();
@@ -785,7 +786,18 @@ LibertyLibrary::makeCornerMap(LibertyCell *cell1,
           TimingArc *arc2 = *arc_itr2;
 	  if (TimingArc::equiv(arc1, arc2))
 	    arc1->setCornerArc(arc2, ap_index);
+	  else
+	    arcs_match = false;
 	}
+        if (!arcs_match)
+          report->warn(1122, "cell %s/%s %s -> %s timing group %s arcs do not match cell %s/%s.",
+                       cell1->library()->name(),
+                       cell1->name(),
+                       arc_set1->from()->name(),
+                       arc_set1->to()->name(),
+                       arc_set1->role()->asString(),
+                       cell2->library()->name(),
+                       cell2->name());
       }
     }
     else
@@ -1307,6 +1319,33 @@ LibertyCell::finish(bool infer_latches,
   makeLatchEnables(report, debug);
   if (infer_latches)
     inferLatchRoles(debug);
+  makeFuncTruthTables();
+}
+
+// Compile the functions evaluated by simulation and power analysis.
+void
+LibertyCell::makeFuncTruthTables()
+{
+  LibertyCellPortBitIterator port_iter(this);
+  while (port_iter.hasNext()) {
+    LibertyPort *port = port_iter.next();
+    FuncExpr *func = port->function();
+    if (func)
+      func->makeTruthTable();
+    FuncExpr *tristate_enable = port->tristateEnable();
+    if (tristate_enable)
+      tristate_enable->makeTruthTable();
+  }
+  for (TimingArcSet *arc_set : timing_arc_sets_) {
+    FuncExpr *cond = arc_set->cond();
+    if (cond)
+      cond->makeTruthTable();
+  }
+  for (InternalPower *pwr : internal_powers_) {
+    FuncExpr *when = pwr->when();
+    if (when)
+      when->makeTruthTable();
+  }
 }
 
 void
@@ -59,12 +59,30 @@ readLibertyFile(const char *filename,
   return reader.readLibertyFile(filename, infer_latches, network);
 }
 
+LibertyLibrary *
+readLibertyFile(const char *filename,
+		bool infer_latches,
+		const StringSet *cell_names,
+		Network *network)
+{
+  LibertyReader reader;
+  reader.setCellNames(cell_names);
+  return reader.readLibertyFile(filename, infer_latches, network);
+}
+
 LibertyReader::LibertyReader() :
-  LibertyGroupVisitor()
+  LibertyGroupVisitor(),
+  cell_names_(nullptr)
 {
   defineVisitors();
 }
 
+void
+LibertyReader::setCellNames(const StringSet *cell_names)
+{
+  cell_names_ = cell_names;
+}
+
 LibertyReader::~LibertyReader()
 {
   if (var_map_) {
@@ -95,6 +113,7 @@ LibertyReader::readLibertyFile(const char *filename,
 {
   filename_ = filename;
   infer_latches_ = infer_latches;
+  skipped_cell_ = nullptr;
   report_ = network->report();
   debug_ = network->debug();
   network_ = network;
@@ -567,25 +586,52 @@ LibertyReader::defineScalingFactorVisitors()
 void
 LibertyReader::visitAttr(LibertyAttr *attr)
 {
-  LibraryAttrVisitor visitor = attr_visitor_map_.findKey(attr->name());
-  if (visitor)
-    (this->*visitor)(attr);
+  if (skipped_cell_ == nullptr) {
+    LibraryAttrVisitor visitor = attr_visitor_map_.findKey(attr->name());
+    if (visitor)
+      (this->*visitor)(attr);
+  }
 }
 
 void
 LibertyReader::begin(LibertyGroup *group)
 {
-  LibraryGroupVisitor visitor = group_begin_map_.findKey(group->type());
-  if (visitor)
-    (this->*visitor)(group);
+  if (skipped_cell_ == nullptr) {
+    if (isSkippedCell(group))
+      skipped_cell_ = group;
+    else {
+      LibraryGroupVisitor visitor = group_begin_map_.findKey(group->type());
+      if (visitor)
+	(this->*visitor)(group);
+    }
+  }
 }
 
 void
 LibertyReader::end(LibertyGroup *group)
 {
-  LibraryGroupVisitor visitor = group_end_map_.findKey(group->type());
-  if (visitor)
-    (this->*visitor)(group);
+  if (skipped_cell_) {
+    if (group == skipped_cell_)
+      skipped_cell_ = nullptr;
+  }
+  else {
+    LibraryGroupVisitor visitor = group_end_map_.findKey(group->type());
+    if (visitor)
+      (this->*visitor)(group);
+  }
+}
+
+bool
+LibertyReader::isSkippedCell(LibertyGroup *group) const
+{
+  if (cell_names_
+      && (stringEq(group->type(), "cell")
+	  || stringEq(group->type(), "scaled_cell"))) {
+    const char *name = group->firstName();
+    return name && !cell_names_->hasKey(name);
+  }
+  else
+    return false;
 }
 
 void
@@ -1370,7 +1416,11 @@ LibertyReader::makeAxis(int index,
       float scale = tableVariableUnit(axis_var, units)->scale();
       scaleFloats(axis_values, scale);
     }
-    return make_shared<TableAxis>(axis_var, axis_values);
+    TableAxisPtr axis = makeSharedTableAxis(axis_var, axis_values);
+    // The axis owns the values, or they were deleted if an equivalent
+    // axis already exists.
+    axis_values_[index] = nullptr;
+    return axis;
   }
   else if (axis_values) {
     libWarn(1176, group, "missing variable_%d attribute.", index + 1);
@@ -4420,7 +4470,9 @@ LibertyReader::makeTableAxis(int index)
     const Units *units = library_->units();
     float scale = tableVariableUnit(var, units)->scale();
     scaleFloats(values, scale);
-    axis_[index] = make_shared<TableAxis>(var, values);
+    axis_[index] = makeSharedTableAxis(var, values);
+    // The values are deleted if an equivalent axis already exists.
+    axis_values_[index] = axis_[index]->values();
   }
 }
 
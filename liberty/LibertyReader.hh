@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include "StringSet.hh"
+
 namespace sta {
 
 class Network;
@@ -25,5 +27,12 @@ LibertyLibrary *
 readLibertyFile(const char *filename,
 		bool infer_latches,
 		Network *network);
+// Only build the cells named in cell_names.
+// Other cell groups are parsed and skipped.
+LibertyLibrary *
+readLibertyFile(const char *filename,
+		bool infer_latches,
+		const StringSet *cell_names,
+		Network *network);
 
 } // namespace
@@ -69,6 +69,8 @@ public:
 					  bool infer_latches,
 					  Network *network);
   LibertyLibrary *library() const { return library_; }
+  // Only build the cells named in cell_names (nullptr for all cells).
+  void setCellNames(const StringSet *cell_names);
   virtual bool save(LibertyGroup *) { return false; }
   virtual bool save(LibertyAttr *) { return false; }
   virtual bool save(LibertyVariable *) { return false; }
@@ -561,8 +563,13 @@ protected:
 		const char *fmt, ...)
     __attribute__((format (printf, 4, 5)));
 
+  bool isSkippedCell(LibertyGroup *group) const;
+
   const char *filename_;
   bool infer_latches_;
+  const StringSet *cell_names_;
+  // Cell group that is not built because it is not in cell_names_.
+  LibertyGroup *skipped_cell_;
   Report *report_;
   Debug *debug_;
   Network *network_;
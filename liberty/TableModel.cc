@@ -16,12 +16,17 @@
 
 #include "TableModel.hh"
 
+#include <algorithm>
 #include <string>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
 
 #include "Error.hh"
 #include "EnumNameMap.hh"
 #include "Units.hh"
 #include "Liberty.hh"
+#include "Hash.hh"
 
 namespace sta {
 
@@ -1496,6 +1501,77 @@ TableAxis::variableString() const
   return tableVariableString(variable_);
 }
 
+////////////////////////////////////////////////////////////////
+
+typedef std::unordered_multimap<size_t, std::weak_ptr<TableAxis>> TableAxisCache;
+
+static TableAxisCache table_axis_cache;
+static std::mutex table_axis_cache_lock;
+// Cache size that triggers a sweep of axes deleted with their library.
+static const size_t table_axis_cache_sweep_min = 1024;
+static size_t table_axis_cache_sweep_size = table_axis_cache_sweep_min;
+
+// Caller holds table_axis_cache_lock.
+static void
+sweepTableAxisCache()
+{
+  auto itr = table_axis_cache.begin();
+  while (itr != table_axis_cache.end()) {
+    if (itr->second.expired())
+      itr = table_axis_cache.erase(itr);
+    else
+      itr++;
+  }
+  // Sweep again when the live entries have doubled.
+  table_axis_cache_sweep_size = std::max(table_axis_cache.size() * 2,
+                                         table_axis_cache_sweep_min);
+}
+
+static size_t
+tableAxisHash(TableAxisVariable variable,
+	      const FloatSeq *values)
+{
+  size_t hash = hash_init_value;
+  hashIncr(hash, static_cast<size_t>(variable));
+  for (float value : *values) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    hashIncr(hash, bits);
+  }
+  return hash;
+}
+
+TableAxisPtr
+makeSharedTableAxis(TableAxisVariable variable,
+		    FloatSeq *values)
+{
+  if (values == nullptr)
+    return make_shared<TableAxis>(variable, values);
+  size_t hash = tableAxisHash(variable, values);
+  std::lock_guard<std::mutex> lock(table_axis_cache_lock);
+  auto range = table_axis_cache.equal_range(hash);
+  auto itr = range.first;
+  while (itr != range.second) {
+    TableAxisPtr axis = itr->second.lock();
+    if (axis == nullptr)
+      // Axis was deleted with its library.
+      itr = table_axis_cache.erase(itr);
+    else {
+      if (axis->variable() == variable
+	  && *axis->values() == *values) {
+	delete values;
+	return axis;
+      }
+      itr++;
+    }
+  }
+  TableAxisPtr axis = make_shared<TableAxis>(variable, values);
+  table_axis_cache.insert({hash, axis});
+  if (table_axis_cache.size() >= table_axis_cache_sweep_size)
+    sweepTableAxisCache();
+  return axis;
+}
+
 const Unit *
 TableAxis::unit(const Units *units)
 {
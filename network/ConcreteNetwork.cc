@@ -266,6 +266,10 @@ ConcreteNetwork::clear()
 {
   deleteTopInstance();
   deleteCellNetworkViews();
+  // Release the object blocks instead of keeping them on the free lists.
+  pin_table_.clear();
+  term_table_.clear();
+  net_table_.clear();
   library_seq_.deleteContentsClear();
   library_map_.clear();
   Network::clear();
@@ -980,6 +984,16 @@ ConcreteNetwork::findChild(const Instance *parent,
   return inst->findChild(name);
 }
 
+void
+ConcreteNetwork::findChildrenMatching(const Instance *parent,
+                                      const PatternMatch *pattern,
+                                      InstanceSeq &matches) const
+{
+  const ConcreteInstance *inst =
+    reinterpret_cast<const ConcreteInstance*>(parent);
+  inst->findChildrenMatching(pattern, matches);
+}
+
 Pin *
 ConcreteNetwork::findPin(const Instance *instance,
 			 const char *port_name) const
@@ -998,6 +1012,24 @@ ConcreteNetwork::findPin(const Instance *instance,
   return reinterpret_cast<Pin*>(inst->findPin(port));
 }
 
+Pin *
+ConcreteNetwork::findPin(const Instance *instance,
+			 const LibertyPort *port) const
+{
+  const ConcreteInstance *inst =
+    reinterpret_cast<const ConcreteInstance*>(instance);
+  const ConcreteCell *cell = port->libertyCell();
+  // Liberty ports of the cell the instance is linked to are its ports,
+  // so the pin can be found without a name lookup.
+  if (cell == reinterpret_cast<const ConcreteCell*>(inst->cell())
+      && !port->isBus()) {
+    const ConcretePort *cport = port;
+    return reinterpret_cast<Pin*>(inst->findPin(reinterpret_cast<const Port*>(cport)));
+  }
+  else
+    return reinterpret_cast<Pin*>(inst->findPin(port->name()));
+}
+
 Net *
 ConcreteNetwork::findNet(const Instance *instance,
 			 const char *net_name) const
@@ -1284,7 +1316,7 @@ ConcreteNetwork::deleteInstance(Instance *inst)
     NetTermIterator *term_iter = termIterator(net);
     while (term_iter->hasNext()) {
       ConcreteTerm *term = reinterpret_cast<ConcreteTerm*>(term_iter->next());
-      delete term;
+      deleteTerm(term);
     }
     delete term_iter;
     deleteNet(net);
@@ -1322,26 +1354,51 @@ ConcreteNetwork::makePin(Instance *inst,
   ConcreteInstance *cinst = reinterpret_cast<ConcreteInstance*>(inst);
   ConcretePort *cport = reinterpret_cast<ConcretePort*>(port);
   ConcreteNet *cnet = reinterpret_cast<ConcreteNet*>(net);
-  ConcretePin *cpin = new ConcretePin(cinst, cport, cnet);
+  ConcretePin *cpin = makeConcretePin(cinst, cport, cnet);
   cinst->addPin(cpin);
   if (cnet)
     connectNetPin(cnet, cpin);
   return reinterpret_cast<Pin*>(cpin);
 }
 
+ConcretePin *
+ConcreteNetwork::makeConcretePin(ConcreteInstance *cinst,
+				 ConcretePort *cport,
+				 ConcreteNet *cnet)
+{
+  ConcretePin *cpin = pin_table_.make();
+  cpin->init(cinst, cport, cnet);
+  return cpin;
+}
+
 Term *
 ConcreteNetwork::makeTerm(Pin *pin,
 			  Net *net)
 {
   ConcretePin *cpin = reinterpret_cast<ConcretePin*>(pin);
   ConcreteNet *cnet = reinterpret_cast<ConcreteNet*>(net);
-  ConcreteTerm *cterm = new ConcreteTerm(cpin, cnet);
+  ConcreteTerm *cterm = makeConcreteTerm(cpin, cnet);
   if (cnet)
     cnet->addTerm(cterm);
   cpin->term_ = cterm;
   return reinterpret_cast<Term*>(cterm);
 }
 
+ConcreteTerm *
+ConcreteNetwork::makeConcreteTerm(ConcretePin *cpin,
+				  ConcreteNet *cnet)
+{
+  ConcreteTerm *cterm = term_table_.make();
+  cterm->init(cpin, cnet);
+  return cterm;
+}
+
+void
+ConcreteNetwork::deleteTerm(ConcreteTerm *cterm)
+{
+  term_table_.destroy(cterm);
+}
+
 Pin *
 ConcreteNetwork::connect(Instance *inst,
 			 LibertyPort *port,
@@ -1374,12 +1431,12 @@ ConcreteNetwork::connect(Instance *inst,
       disconnectNetPin(prev_net, cpin);
   }
   else {
-    cpin = new ConcretePin(cinst, cport, cnet);
+    cpin = makeConcretePin(cinst, cport, cnet);
     cinst->addPin(cpin);
   }
   if (inst == top_instance_) {
     // makeTerm
-    ConcreteTerm *cterm = new ConcreteTerm(cpin, cnet);
+    ConcreteTerm *cterm = makeConcreteTerm(cpin, cnet);
     if (cnet)
       cnet->addTerm(cterm);
     cpin->term_ = cterm;
@@ -1426,7 +1483,7 @@ ConcreteNetwork::disconnectPin(Pin *pin)
 	clearNetDrvrPinMap();
       }
       cpin->term_ = nullptr;
-      delete cterm;
+      deleteTerm(cterm);
     }
   }
   else {
@@ -1470,7 +1527,7 @@ ConcreteNetwork::deletePin(Pin *pin)
     reinterpret_cast<ConcreteInstance*>(cpin->instance());
   if (cinst)
     cinst->deletePin(cpin);
-  delete cpin;
+  pin_table_.destroy(cpin);
 }
 
 Net *
@@ -1478,7 +1535,8 @@ ConcreteNetwork::makeNet(const char *name,
 			 Instance *parent)
 {
   ConcreteInstance *cparent = reinterpret_cast<ConcreteInstance*>(parent);
-  ConcreteNet *net = new ConcreteNet(name, cparent);
+  ConcreteNet *net = net_table_.make();
+  net->init(name, cparent);
   cparent->addNet(net);
   return reinterpret_cast<Net*>(net);
 }
@@ -1506,7 +1564,8 @@ ConcreteNetwork::deleteNet(Net *net)
   ConcreteInstance *cinst =
     reinterpret_cast<ConcreteInstance*>(cnet->instance());
   cinst->deleteNet(cnet);
-  delete cnet;
+  cnet->deleteName();
+  net_table_.destroy(cnet);
 }
 
 void
@@ -1648,18 +1707,55 @@ ConcreteInstance::findNet(const char *net_name) const
   return net;
 }
 
+// The name maps are sorted, so only the range of names that start
+// with the literal prefix of the pattern needs to be matched.
+template <class NAME_MAP>
+static typename NAME_MAP::const_iterator
+patternPrefixBegin(const NAME_MAP *name_map,
+                   const PatternMatch *pattern,
+                   string &prefix)
+{
+  prefix.assign(pattern->pattern(), pattern->literalPrefixLength());
+  return name_map->lower_bound(prefix.c_str());
+}
+
+void
+ConcreteInstance::findChildrenMatching(const PatternMatch *pattern,
+                                       InstanceSeq &matches) const
+{
+  if (pattern->hasWildcards()) {
+    if (children_) {
+      string prefix;
+      for (auto child_iter = patternPrefixBegin(children_, pattern, prefix);
+           child_iter != children_->end()
+             && stringBeginEq(child_iter->first, prefix.c_str());
+           child_iter++) {
+        if (pattern->match(child_iter->first))
+          matches.push_back(reinterpret_cast<Instance*>(child_iter->second));
+      }
+    }
+  }
+  else {
+    Instance *child = findChild(pattern->pattern());
+    if (child)
+      matches.push_back(child);
+  }
+}
+
 void
 ConcreteInstance::findNetsMatching(const PatternMatch *pattern,
                                    NetSeq &matches) const
 {
   if (pattern->hasWildcards()) {
-    ConcreteInstanceNetMap::Iterator net_iter(nets_);
-    while (net_iter.hasNext()) {
-      const char *net_name;
-      ConcreteNet *cnet;
-      net_iter.next(net_name, cnet);
-      if (pattern->match(net_name))
-	matches.push_back(reinterpret_cast<Net*>(cnet));
+    if (nets_) {
+      string prefix;
+      for (auto net_iter = patternPrefixBegin(nets_, pattern, prefix);
+           net_iter != nets_->end()
+             && stringBeginEq(net_iter->first, prefix.c_str());
+           net_iter++) {
+        if (pattern->match(net_iter->first))
+          matches.push_back(reinterpret_cast<Net*>(net_iter->second));
+      }
     }
   }
   else {
@@ -1760,20 +1856,40 @@ ConcreteInstance::setCell(ConcreteCell *cell)
 
 ////////////////////////////////////////////////////////////////
 
-ConcretePin::ConcretePin(ConcreteInstance *instance,
-			 ConcretePort *port,
-			 ConcreteNet *net) :
-  instance_(instance),
-  port_(port),
-  net_(net),
+ConcretePin::ConcretePin() :
+  instance_(nullptr),
+  port_(nullptr),
+  net_(nullptr),
   term_(nullptr),
-  id_(ConcreteNetwork::nextObjectId()),
+  id_(object_id_null),
+  object_idx_(object_idx_null),
   net_next_(nullptr),
   net_prev_(nullptr),
   vertex_id_(vertex_id_null)
 {
 }
 
+void
+ConcretePin::init(ConcreteInstance *instance,
+		  ConcretePort *port,
+		  ConcreteNet *net)
+{
+  instance_ = instance;
+  port_ = port;
+  net_ = net;
+  term_ = nullptr;
+  id_ = ConcreteNetwork::nextObjectId();
+  net_next_ = nullptr;
+  net_prev_ = nullptr;
+  vertex_id_ = vertex_id_null;
+}
+
+void
+ConcretePin::setObjectIdx(ObjectIdx idx)
+{
+  object_idx_ = idx;
+}
+
 const char *
 ConcretePin::name() const
 {
@@ -1797,31 +1913,67 @@ ConcreteTerm::name() const
   return cport->name();
 }
 
-ConcreteTerm::ConcreteTerm(ConcretePin *pin,
-			   ConcreteNet *net) :
-  pin_(pin),
-  net_(net),
-  id_(ConcreteNetwork::nextObjectId()),
+ConcreteTerm::ConcreteTerm() :
+  pin_(nullptr),
+  net_(nullptr),
+  id_(object_id_null),
+  object_idx_(object_idx_null),
   net_next_(nullptr)
 {
 }
 
+void
+ConcreteTerm::init(ConcretePin *pin,
+		   ConcreteNet *net)
+{
+  pin_ = pin;
+  net_ = net;
+  id_ = ConcreteNetwork::nextObjectId();
+  net_next_ = nullptr;
+}
+
+void
+ConcreteTerm::setObjectIdx(ObjectIdx idx)
+{
+  object_idx_ = idx;
+}
+
 ////////////////////////////////////////////////////////////////
 
-ConcreteNet::ConcreteNet(const char *name,
-			 ConcreteInstance *instance) :
-  name_(stringCopy(name)),
-  id_(ConcreteNetwork::nextObjectId()),
-  instance_(instance),
+ConcreteNet::ConcreteNet() :
+  name_(nullptr),
+  id_(object_id_null),
+  object_idx_(object_idx_null),
+  instance_(nullptr),
   pins_(nullptr),
   terms_(nullptr),
   merged_into_(nullptr)
 {
 }
 
-ConcreteNet::~ConcreteNet()
+void
+ConcreteNet::init(const char *name,
+		  ConcreteInstance *instance)
+{
+  name_ = stringCopy(name);
+  id_ = ConcreteNetwork::nextObjectId();
+  instance_ = instance;
+  pins_ = nullptr;
+  terms_ = nullptr;
+  merged_into_ = nullptr;
+}
+
+void
+ConcreteNet::deleteName()
 {
   stringDelete(name_);
+  name_ = nullptr;
+}
+
+void
+ConcreteNet::setObjectIdx(ObjectIdx idx)
+{
+  object_idx_ = idx;
 }
 
 // Merged nets are kept around to serve as name aliases.
@@ -17,6 +17,7 @@
 #include "ConcreteParasitics.hh"
 
 #include <algorithm> // max
+#include <climits>
 
 #include "Report.hh"
 #include "Debug.hh"
@@ -41,6 +42,9 @@ namespace sta {
 
 using std::max;
 
+// Ids below this are always kept in the parasitic network subnode vector.
+static const size_t dense_sub_node_min = 64;
+
 ConcreteParasitic::~ConcreteParasitic()
 {
 }
@@ -493,10 +497,34 @@ ConcreteParasiticNetwork::ConcreteParasiticNetwork(const Net *net,
   sub_nodes_(network),
   pin_nodes_(network),
   max_node_id_(0),
-  includes_pin_caps_(includes_pin_caps)
+  includes_pin_caps_(includes_pin_caps),
+  own_sub_nodes_dense_(true)
 {
 }
 
+// Visit subnodes in (net, id) order.
+template <class VISITOR>
+void
+ConcreteParasiticNetwork::visitSubNodes(VISITOR visitor) const
+{
+  if (own_sub_nodes_dense_) {
+    // The map has no net_ subnodes so they go between the other nets.
+    auto own_pos = sub_nodes_.lower_bound(NetIdPair(net_, INT_MIN));
+    for (auto itr = sub_nodes_.begin(); itr != own_pos; itr++)
+      visitor(itr->second);
+    for (ConcreteParasiticNode *node : own_sub_nodes_) {
+      if (node)
+        visitor(node);
+    }
+    for (auto itr = own_pos; itr != sub_nodes_.end(); itr++)
+      visitor(itr->second);
+  }
+  else {
+    for (auto id_node : sub_nodes_)
+      visitor(id_node.second);
+  }
+}
+
 ConcreteParasiticNetwork::~ConcreteParasiticNetwork()
 {
   deleteDevices();
@@ -506,10 +534,9 @@ ConcreteParasiticNetwork::~ConcreteParasiticNetwork()
 void
 ConcreteParasiticNetwork::deleteNodes()
 {
-  for (auto id_node : sub_nodes_) {
-    ConcreteParasiticNode *node = id_node.second;
+  visitSubNodes([] (ConcreteParasiticNode *node) {
     delete node;
-  }
+  });
   for (auto pin_node : pin_nodes_) {
     ConcreteParasiticNode *node = pin_node.second;
     delete node;
@@ -551,10 +578,9 @@ ConcreteParasiticNetwork::nodes() const
     ParasiticNode *node = pin_node.second;
     nodes.push_back(node);
   }
-  for (auto id_node : sub_nodes_) {
-    ParasiticNode *node = id_node.second;
+  visitSubNodes([&] (ConcreteParasiticNode *node) {
     nodes.push_back(node);
-  }
+  });
   return nodes;
 }
 
@@ -562,11 +588,10 @@ float
 ConcreteParasiticNetwork::capacitance() const
 {
   float cap = 0.0;
-  for (auto id_node : sub_nodes_) {
-    ConcreteParasiticNode *node = id_node.second;
+  visitSubNodes([&] (ConcreteParasiticNode *node) {
     if (!node->isExternal())
       cap += node->capacitance();
-  }
+  });
 
   for (auto pin_node : pin_nodes_) {
     ConcreteParasiticNode *node = pin_node.second;
@@ -588,6 +613,12 @@ ConcreteParasiticNetwork::findParasiticNode(const Net *net,
                                             int id,
                                             const Network *) const
 {
+  if (net == net_ && own_sub_nodes_dense_) {
+    if (id >= 0 && static_cast<size_t>(id) < own_sub_nodes_.size())
+      return own_sub_nodes_[id];
+    else
+      return nullptr;
+  }
   NetIdPair net_id(net, id);
   auto id_node = sub_nodes_.find(net_id);
   if (id_node == sub_nodes_.end()) 
@@ -609,21 +640,45 @@ ConcreteParasiticNetwork::findParasiticNode(const Pin *pin) const
 ConcreteParasiticNode *
 ConcreteParasiticNetwork::ensureParasiticNode(const Net *net,
 					      int id,
-                                              const Network *)
+                                              const Network *network)
 {
-  ConcreteParasiticNode *node;
-  NetIdPair net_id(net, id);
-  auto id_node = sub_nodes_.find(net_id);
-  if (id_node == sub_nodes_.end()) {
+  ConcreteParasiticNode *node = findParasiticNode(net, id, network);
+  if (node == nullptr) {
     node = new ConcreteParasiticNode(net, id, net != net_);
-    sub_nodes_[net_id] = node;
+    if (net == net_ && own_sub_nodes_dense_) {
+      // Keep the vector at most twice as long as needed.
+      size_t dense_max = max(own_sub_nodes_.size() * 2, dense_sub_node_min);
+      if (id >= 0 && static_cast<size_t>(id) < dense_max) {
+        if (static_cast<size_t>(id) >= own_sub_nodes_.size())
+          own_sub_nodes_.resize(id + 1, nullptr);
+        own_sub_nodes_[id] = node;
+      }
+      else {
+        moveOwnSubNodes();
+        sub_nodes_[NetIdPair(net, id)] = node;
+      }
+    }
+    else
+      sub_nodes_[NetIdPair(net, id)] = node;
     max_node_id_ = max((int) max_node_id_, id);
   }
-  else
-    node = id_node->second;
   return node;
 }
 
+// Switch net_ subnodes to the map when their ids are sparse.
+void
+ConcreteParasiticNetwork::moveOwnSubNodes()
+{
+  for (size_t id = 0; id < own_sub_nodes_.size(); id++) {
+    ConcreteParasiticNode *node = own_sub_nodes_[id];
+    if (node)
+      sub_nodes_[NetIdPair(net_, id)] = node;
+  }
+  own_sub_nodes_.clear();
+  own_sub_nodes_.shrink_to_fit();
+  own_sub_nodes_dense_ = false;
+}
+
 ConcreteParasiticNode *
 ConcreteParasiticNetwork::ensureParasiticNode(const Pin *pin,
                                               const Network *network)
@@ -749,6 +804,116 @@ NetIdPairLess::operator()(const NetIdPair &net_id1,
 
 ////////////////////////////////////////////////////////////////
 
+ConcreteDrvrParasitics::ConcreteDrvrParasitics() :
+  pages_(new std::atomic<DrvrSlots*>[page_count]),
+  drvr_count_(0)
+{
+  for (size_t i = 0; i < page_count; i++)
+    pages_[i].store(nullptr, std::memory_order_relaxed);
+}
+
+ConcreteDrvrParasitics::~ConcreteDrvrParasitics()
+{
+  // The parasitics are deleted by ConcreteParasitics::deleteParasitics.
+  for (size_t i = 0; i < page_count; i++) {
+    DrvrSlots *page = pages_[i].load(std::memory_order_relaxed);
+    if (page) {
+      for (size_t j = 0; j < page_size; j++)
+	delete [] page[j].load(std::memory_order_relaxed);
+      delete [] page;
+    }
+  }
+  delete [] pages_;
+}
+
+ConcreteParasiticSlot *
+ConcreteDrvrParasitics::findSlots(ObjectId pin_id) const
+{
+  DrvrSlots *page = pages_[pin_id >> page_bits].load(std::memory_order_acquire);
+  if (page)
+    return page[pin_id & (page_size - 1)].load(std::memory_order_acquire);
+  else
+    return nullptr;
+}
+
+ConcreteParasiticSlot *
+ConcreteDrvrParasitics::ensureSlots(ObjectId pin_id,
+				    size_t slot_count)
+{
+  std::atomic<DrvrSlots*> &page_ref = pages_[pin_id >> page_bits];
+  DrvrSlots *page = page_ref.load(std::memory_order_acquire);
+  if (page == nullptr) {
+    page = new DrvrSlots[page_size];
+    for (size_t i = 0; i < page_size; i++)
+      page[i].store(nullptr, std::memory_order_relaxed);
+    page_ref.store(page, std::memory_order_release);
+  }
+  DrvrSlots &slots_ref = page[pin_id & (page_size - 1)];
+  ConcreteParasiticSlot *slots = slots_ref.load(std::memory_order_acquire);
+  if (slots == nullptr) {
+    slots = new ConcreteParasiticSlot[slot_count];
+    for (size_t i = 0; i < slot_count; i++)
+      slots[i].store(nullptr, std::memory_order_relaxed);
+    slots_ref.store(slots, std::memory_order_release);
+    drvr_count_++;
+  }
+  return slots;
+}
+
+void
+ConcreteDrvrParasitics::deleteSlots(ObjectId pin_id,
+				    size_t slot_count)
+{
+  DrvrSlots *page = pages_[pin_id >> page_bits].load(std::memory_order_acquire);
+  if (page) {
+    DrvrSlots &slots_ref = page[pin_id & (page_size - 1)];
+    ConcreteParasiticSlot *slots = slots_ref.exchange(nullptr);
+    if (slots) {
+      // Readers may still be indexing the slots.
+      for (size_t i = 0; i < slot_count; i++)
+	retire(slots[i].load(std::memory_order_relaxed));
+      retired_slots_.push_back(slots);
+      drvr_count_--;
+    }
+  }
+}
+
+void
+ConcreteDrvrParasitics::retire(ConcreteParasitic *parasitic)
+{
+  if (parasitic)
+    retired_parasitics_.push_back(parasitic);
+}
+
+void
+ConcreteDrvrParasitics::clear(size_t slot_count)
+{
+  if (drvr_count_ > 0) {
+    for (size_t i = 0; i < page_count; i++) {
+      DrvrSlots *page = pages_[i].load(std::memory_order_acquire);
+      if (page) {
+	for (size_t j = 0; j < page_size; j++) {
+	  ConcreteParasiticSlot *slots = page[j].exchange(nullptr);
+	  if (slots) {
+	    for (size_t k = 0; k < slot_count; k++)
+	      delete slots[k].load(std::memory_order_relaxed);
+	    delete [] slots;
+	  }
+	}
+      }
+    }
+    drvr_count_ = 0;
+  }
+  for (ConcreteParasitic *parasitic : retired_parasitics_)
+    delete parasitic;
+  retired_parasitics_.clear();
+  for (ConcreteParasiticSlot *slots : retired_slots_)
+    delete [] slots;
+  retired_slots_.clear();
+}
+
+////////////////////////////////////////////////////////////////
+
 Parasitics *
 makeConcreteParasitics(StaState *sta)
 {
@@ -768,7 +933,7 @@ ConcreteParasitics::~ConcreteParasitics()
 bool
 ConcreteParasitics::haveParasitics()
 {
-  return !drvr_parasitic_map_.empty()
+  return !drvr_parasitics_.empty()
     || !parasitic_network_map_.empty();
 }
 
@@ -785,20 +950,17 @@ ConcreteParasitics::parasiticAnalysisPtIndex(const ParasiticAnalysisPt *ap,
   return ap->index() * RiseFall::index_count + rf->index();
 }
 
+size_t
+ConcreteParasitics::drvrParasiticSlotCount() const
+{
+  return corners_->parasiticAnalysisPtCount() * RiseFall::index_count;
+}
+
 void
 ConcreteParasitics::deleteParasitics()
 {
   int ap_count = corners_->parasiticAnalysisPtCount();
-  int ap_rf_count = ap_count * RiseFall::index_count;
-  for (auto drvr_parasitics : drvr_parasitic_map_) {
-    ConcreteParasitic **parasitics = drvr_parasitics.second;
-    if (parasitics) {
-      for (int i = 0; i < ap_rf_count; i++)
-	delete parasitics[i];
-      delete [] parasitics;
-    }
-  }
-  drvr_parasitic_map_.clear();
+  drvr_parasitics_.clear(drvrParasiticSlotCount());
 
   for (auto net_parasitics : parasitic_network_map_) {
     ConcreteParasiticNetwork **parasitics = net_parasitics.second;
@@ -815,12 +977,13 @@ void
 ConcreteParasitics::deleteParasitics(const Pin *drvr_pin,
 				     const ParasiticAnalysisPt *ap)
 {
-  ConcreteParasitic **parasitics = drvr_parasitic_map_[drvr_pin];
+  UniqueLock lock(lock_);
+  ConcreteParasiticSlot *parasitics =
+    drvr_parasitics_.findSlots(network_->id(drvr_pin));
   if (parasitics) {
     for (auto tr : RiseFall::range()) {
       int ap_rf_index = parasiticAnalysisPtIndex(ap, tr);
-      delete parasitics[ap_rf_index];
-      parasitics[ap_rf_index] = nullptr;
+      drvr_parasitics_.retire(parasitics[ap_rf_index].exchange(nullptr));
     }
   }
 }
@@ -895,7 +1058,7 @@ void
 ConcreteParasitics::deleteReducedParasitics(const Net *net,
                                             const ParasiticAnalysisPt *ap)
 {
-  if (!drvr_parasitic_map_.empty()) {
+  if (!drvr_parasitics_.empty()) {
     PinSet *drivers = network_->drivers(net);
     if (drivers) {
       for (auto drvr_pin : *drivers)
@@ -908,7 +1071,7 @@ ConcreteParasitics::deleteReducedParasitics(const Net *net,
 void
 ConcreteParasitics::deleteReducedParasitics(const Pin *pin)
 {
-  if (!drvr_parasitic_map_.empty()) {
+  if (!drvr_parasitics_.empty()) {
     PinSet *drivers = network_->drivers(pin);
     if (drivers) {
       for (auto drvr_pin : *drivers)
@@ -921,15 +1084,8 @@ void
 ConcreteParasitics::deleteDrvrReducedParasitics(const Pin *drvr_pin)
 {
   UniqueLock lock(lock_);
-  ConcreteParasitic **parasitics = drvr_parasitic_map_[drvr_pin];
-  if (parasitics) {
-    int ap_count = corners_->parasiticAnalysisPtCount();
-    int ap_rf_count = ap_count * RiseFall::index_count;
-    for (int i = 0; i < ap_rf_count; i++)
-      delete parasitics[i];
-    delete [] parasitics;
-  }
-  drvr_parasitic_map_[drvr_pin] = nullptr;
+  drvr_parasitics_.deleteSlots(network_->id(drvr_pin),
+			       drvrParasiticSlotCount());
 }
 
 void
@@ -937,11 +1093,13 @@ ConcreteParasitics::deleteDrvrReducedParasitics(const Pin *drvr_pin,
                                                 const ParasiticAnalysisPt *ap)
 {
   UniqueLock lock(lock_);
-  ConcreteParasitic **parasitics = drvr_parasitic_map_[drvr_pin];
+  ConcreteParasiticSlot *parasitics =
+    drvr_parasitics_.findSlots(network_->id(drvr_pin));
   if (parasitics) {
-    int ap_index = ap->index();
-    delete parasitics[ap_index];
-    parasitics[ap_index] = nullptr;
+    for (auto rf : RiseFall::range()) {
+      int ap_rf_index = parasiticAnalysisPtIndex(ap, rf);
+      drvr_parasitics_.retire(parasitics[ap_rf_index].exchange(nullptr));
+    }
   }
 }
 
@@ -959,10 +1117,10 @@ ConcreteParasitics::findPiElmore(const Pin *drvr_pin,
 				 const RiseFall *rf,
 				 const ParasiticAnalysisPt *ap) const
 {
-  if (!drvr_parasitic_map_.empty()) {
+  if (!drvr_parasitics_.empty()) {
     int ap_rf_index = parasiticAnalysisPtIndex(ap, rf);
-    UniqueLock lock(lock_);
-    ConcreteParasitic **parasitics = drvr_parasitic_map_.findKey(drvr_pin);
+    ConcreteParasiticSlot *parasitics =
+      drvr_parasitics_.findSlots(network_->id(drvr_pin));
     if (parasitics) {
       ConcreteParasitic *parasitic = parasitics[ap_rf_index];
       if (parasitic && parasitic->isPiElmore())
@@ -981,15 +1139,9 @@ ConcreteParasitics::makePiElmore(const Pin *drvr_pin,
 				 float c1)
 {
   UniqueLock lock(lock_);
-  ConcreteParasitic **parasitics = drvr_parasitic_map_.findKey(drvr_pin);
-  if (parasitics == nullptr) {
-    int ap_count = corners_->parasiticAnalysisPtCount();
-    int ap_rf_count = ap_count * RiseFall::index_count;
-    parasitics = new ConcreteParasitic*[ap_rf_count];
-    for (int i = 0; i < ap_rf_count; i++)
-      parasitics[i] = nullptr;
-    drvr_parasitic_map_[drvr_pin] = parasitics;
-  }
+  ConcreteParasiticSlot *parasitics =
+    drvr_parasitics_.ensureSlots(network_->id(drvr_pin),
+				 drvrParasiticSlotCount());
   int ap_rf_index = parasiticAnalysisPtIndex(ap, rf);
   ConcreteParasitic *parasitic = parasitics[ap_rf_index];
   ConcretePiElmore *pi_elmore = nullptr;
@@ -999,9 +1151,10 @@ ConcreteParasitics::makePiElmore(const Pin *drvr_pin,
       pi_elmore->setPiModel(c2, rpi, c1);
     }
     else {
-      delete parasitic;
+      // Publish the replacement before retiring the old parasitic.
       pi_elmore = new ConcretePiElmore(c2, rpi, c1);
       parasitics[ap_rf_index] = pi_elmore;
+      drvr_parasitics_.retire(parasitic);
     }
   }
   else {
@@ -1075,10 +1228,10 @@ ConcreteParasitics::findPiPoleResidue(const Pin *drvr_pin,
 				      const RiseFall *rf,
 				      const ParasiticAnalysisPt *ap) const
 {
-  if (!drvr_parasitic_map_.empty()) {
+  if (!drvr_parasitics_.empty()) {
     int ap_rf_index = parasiticAnalysisPtIndex(ap, rf);
-    UniqueLock lock(lock_);
-    ConcreteParasitic **parasitics = drvr_parasitic_map_.findKey(drvr_pin);
+    ConcreteParasiticSlot *parasitics =
+      drvr_parasitics_.findSlots(network_->id(drvr_pin));
     if (parasitics) {
       ConcreteParasitic *parasitic = parasitics[ap_rf_index];
       if (parasitic == nullptr && rf == RiseFall::fall()) {
@@ -1101,15 +1254,9 @@ ConcreteParasitics::makePiPoleResidue(const Pin *drvr_pin,
 				      float c1)
 {
   UniqueLock lock(lock_);
-  ConcreteParasitic **parasitics = drvr_parasitic_map_.findKey(drvr_pin);
-  if (parasitics == nullptr) {
-    int ap_count = corners_->parasiticAnalysisPtCount();
-    int ap_rf_count = ap_count * RiseFall::index_count;
-    parasitics = new ConcreteParasitic*[ap_rf_count];
-    for (int i = 0; i < ap_rf_count; i++)
-      parasitics[i] = nullptr;
-    drvr_parasitic_map_[drvr_pin] = parasitics;
-  }
+  ConcreteParasiticSlot *parasitics =
+    drvr_parasitics_.ensureSlots(network_->id(drvr_pin),
+				 drvrParasiticSlotCount());
   int ap_rf_index = parasiticAnalysisPtIndex(ap, rf);
   ConcreteParasitic *parasitic = parasitics[ap_rf_index];
   ConcretePiPoleResidue *pi_pole_residue = nullptr;
@@ -1119,9 +1266,10 @@ ConcreteParasitics::makePiPoleResidue(const Pin *drvr_pin,
       pi_pole_residue->setPiModel(c2, rpi, c1);
     }
     else {
-      delete parasitic;
+      // Publish the replacement before retiring the old parasitic.
       pi_pole_residue = new ConcretePiPoleResidue(c2, rpi, c1);
       parasitics[ap_rf_index] = pi_pole_residue;
+      drvr_parasitics_.retire(parasitic);
     }
   }
   else {
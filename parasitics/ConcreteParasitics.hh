@@ -17,6 +17,8 @@
 #pragma once
 
 #include <mutex>
+#include <atomic>
+#include <vector>
 
 #include "Map.hh"
 #include "Set.hh"
@@ -28,10 +30,58 @@ namespace sta {
 class ConcreteParasitic;
 class ConcreteParasiticNetwork;
 
-typedef Map<const Pin*, ConcreteParasitic**> ConcreteParasiticMap;
 typedef Map<const Net*, ConcreteParasiticNetwork**> ConcreteParasiticNetworkMap;
+typedef std::atomic<ConcreteParasitic*> ConcreteParasiticSlot;
+
+// Reduced parasitics of driver pins indexed by pin id.
+// Each driver has a slot per parasitic analysis point and transition.
+// Driver pages, slot arrays and parasitics are published atomically so
+// lookups do not lock.
+//
+// There is a single writer at a time; the caller serializes ensureSlots,
+// deleteSlots and retire. Readers may run concurrently with the writer,
+// so slot arrays and parasitics that are removed are retired instead of
+// deleted. Retired objects are deleted by clear, which must not run
+// concurrently with readers (no concurrent delete).
+class ConcreteDrvrParasitics
+{
+public:
+  ConcreteDrvrParasitics();
+  ~ConcreteDrvrParasitics();
+  bool empty() const { return drvr_count_ == 0; }
+  // nullptr if the driver does not have slots.
+  ConcreteParasiticSlot *findSlots(ObjectId pin_id) const;
+  ConcreteParasiticSlot *ensureSlots(ObjectId pin_id,
+				     size_t slot_count);
+  // Remove the slots of a driver and retire them and their parasitics.
+  void deleteSlots(ObjectId pin_id,
+		   size_t slot_count);
+  // Retire a parasitic that has been removed from its slot.
+  void retire(ConcreteParasitic *parasitic);
+  // Delete all slots, parasitics and retired objects.
+  void clear(size_t slot_count);
+
+private:
+  typedef std::atomic<ConcreteParasiticSlot*> DrvrSlots;
+
+  static const int page_bits = 16;
+  static const size_t page_size = size_t(1) << page_bits;
+  static const size_t page_count = (size_t(1) << 32) >> page_bits;
+
+  std::atomic<DrvrSlots*> *pages_;
+  std::atomic<size_t> drvr_count_;
+  std::vector<ConcreteParasiticSlot*> retired_slots_;
+  std::vector<ConcreteParasitic*> retired_parasitics_;
+};
 
 // This class acts as a BUILDER for parasitics.
+//
+// findPiElmore and findPiPoleResidue do not lock, so they can run in
+// the delay calculation threads while another thread makes or deletes
+// reduced parasitics (edits are serialized by lock_). Reduced
+// parasitics that are replaced or deleted are retired, not freed, until
+// clear or deleteParasitics(), which must only be called when no
+// delay calculation is running.
 class ConcreteParasitics : public Parasitics
 {
 public:
@@ -177,10 +227,13 @@ protected:
   void deleteDrvrReducedParasitics(const Pin *drvr_pin,
                                    const ParasiticAnalysisPt *ap);
 
-  // Driver pin to array of parasitics indexed by analysis pt index
+  size_t drvrParasiticSlotCount() const;
+
+  // Driver pin id to array of parasitics indexed by analysis pt index
   // and transition.
-  ConcreteParasiticMap drvr_parasitic_map_;
+  ConcreteDrvrParasitics drvr_parasitics_;
   ConcreteParasiticNetworkMap parasitic_network_map_;
+  // Serializes parasitic edits and parasitic network lookups.
   mutable std::mutex lock_;
 
   friend class ConcretePiElmore;
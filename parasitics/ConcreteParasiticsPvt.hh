@@ -43,6 +43,7 @@ typedef std::map<const Pin*, float> ConcreteElmoreLoadMap;
 typedef std::map<const Pin*, ConcretePoleResidue> ConcretePoleResidueMap;
 typedef std::map<NetIdPair,ConcreteParasiticNode*,
                  NetIdPairLess> ConcreteParasiticSubNodeMap;
+typedef std::vector<ConcreteParasiticNode*> ConcreteParasiticNodeSeq;
 typedef std::map<const Pin*, ConcreteParasiticNode*, PinIdLess> ConcreteParasiticPinNodeMap;
 typedef std::set<ParasiticNode*> ParasiticNodeSet;
 typedef std::set<ParasiticResistor*> ParasiticResistorSet;
@@ -241,14 +242,21 @@ private:
 
   void deleteNodes();
   void deleteDevices();
+  template <class VISITOR>
+  void visitSubNodes(VISITOR visitor) const;
+  void moveOwnSubNodes();
 
   const Net *net_;
+  // Subnodes of net_ indexed by id while the ids are dense.
+  ConcreteParasiticNodeSeq own_sub_nodes_;
+  // Subnodes of other nets, and of net_ once its ids are sparse.
   ConcreteParasiticSubNodeMap sub_nodes_;
   ConcreteParasiticPinNodeMap pin_nodes_;
   ParasiticResistorSeq resistors_;
   ParasiticCapacitorSeq capacitors_;
   unsigned max_node_id_:31;
   bool includes_pin_caps_:1;
+  bool own_sub_nodes_dense_:1;
 };
 
 class ConcreteParasiticNode : public ParasiticNode
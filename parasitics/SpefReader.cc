@@ -73,6 +73,19 @@ readSpefFile(const char *filename,
   return success;
 }
 
+////////////////////////////////////////////////////////////////
+
+SpefNameMapEntry::SpefNameMapEntry() :
+  name_(nullptr),
+  inst_(nullptr),
+  net_(nullptr),
+  inst_found_(false),
+  net_found_(false)
+{
+}
+
+////////////////////////////////////////////////////////////////
+
 SpefReader::SpefReader(const char *filename,
 		       gzFile stream,
 		       Instance *instance,
@@ -120,8 +133,8 @@ SpefReader::~SpefReader()
     design_flow_ = nullptr;
   }
 
-  for (auto index_name : name_map_) {
-    char *name = index_name.second;
+  for (auto &index_entry : name_map_) {
+    char *name = index_entry.second.name_;
     stringDelete(name);
   }
 }
@@ -281,24 +294,60 @@ SpefReader::makeNameMapEntry(char *index,
 			     char *name)
 {
   int i = atoi(index + 1);
-  name_map_[i] = name;
+  SpefNameMapEntry &entry = name_map_[i];
+  stringDelete(entry.name_);
+  entry = SpefNameMapEntry();
+  entry.name_ = name;
+}
+
+SpefNameMapEntry *
+SpefReader::nameMapEntry(const char *name)
+{
+  int index = atoi(name + 1);
+  auto itr = name_map_.find(index);
+  if (itr != name_map_.end())
+    return &itr->second;
+  else {
+    warn(1645, "no name map entry for %d.", index);
+    return nullptr;
+  }
 }
 
 char *
 SpefReader::nameMapLookup(char *name)
 {
   if (name && name[0] == '*') {
-    int index = atoi(name + 1);
-    auto itr = name_map_.find(index);
-    if (itr != name_map_.end())
-      return itr->second;
+    SpefNameMapEntry *entry = nameMapEntry(name);
+    return entry ? entry->name_ : nullptr;
+  }
+  else
+    return name;
+}
+
+Instance *
+SpefReader::findInstance(char *name,
+                         // Return value.
+                         char *&mapped_name)
+{
+  if (name[0] == '*') {
+    SpefNameMapEntry *entry = nameMapEntry(name);
+    if (entry) {
+      mapped_name = entry->name_;
+      if (!entry->inst_found_) {
+        entry->inst_ = findInstanceRelative(entry->name_);
+        entry->inst_found_ = true;
+      }
+      return entry->inst_;
+    }
     else {
-      warn(1645, "no name map entry for %d.", index);
+      mapped_name = nullptr;
       return nullptr;
     }
   }
-  else
-    return name;
+  else {
+    mapped_name = name;
+    return findInstanceRelative(name);
+  }
 }
 
 PortDirection *
@@ -330,9 +379,10 @@ SpefReader::findPin(char *name)
     char *delim = strrchr(name, delimiter_);
     if (delim) {
       *delim = '\0';
-      name = nameMapLookup(name);
+      char *mapped_name;
+      Instance *inst = findInstance(name, mapped_name);
+      name = mapped_name;
       if (name) {
-        Instance *inst = findInstanceRelative(name);
         // Replace delimiter for error messages.
         *delim = delimiter_;
         const char *port_name = delim + 1;
@@ -358,12 +408,23 @@ Net *
 SpefReader::findNet(char *name)
 {
   Net *net = nullptr;
-  name = nameMapLookup(name);
-  if (name) {
-    net = findNetRelative(name);
-    if (net == nullptr)
-      warn(1650, "net %s not found.", name);
+  if (name && name[0] == '*') {
+    SpefNameMapEntry *entry = nameMapEntry(name);
+    if (entry) {
+      if (!entry->net_found_) {
+        entry->net_ = findNetRelative(entry->name_);
+        entry->net_found_ = true;
+      }
+      net = entry->net_;
+      name = entry->name_;
+    }
+    else
+      name = nullptr;
   }
+  else if (name)
+    net = findNetRelative(name);
+  if (name && net == nullptr)
+    warn(1650, "net %s not found.", name);
   return net;
 }
 
@@ -467,22 +528,22 @@ SpefReader::findParasiticNode(char *name,
     if (delim) {
       *delim = '\0';
       char *name2 = delim + 1;
-      name = nameMapLookup(name);
-      if (name) {
-        Instance *inst = findInstanceRelative(name);
+      char *mapped_name;
+      Instance *inst = findInstance(name, mapped_name);
+      if (mapped_name) {
         if (inst) {
           // <instance>:<port>
           Pin *pin = network_->findPin(inst, name2);
           if (pin) {
             if (local_only
                 && !network_->isConnected(net_, pin))
-              warn(1651, "%s not connected to net %s.", name, network_->pathName(net_));
+              warn(1651, "%s not connected to net %s.", mapped_name, network_->pathName(net_));
             return parasitics_->ensureParasiticNode(parasitic_, pin, network_);
           }
           else {
             // Replace delimiter for error message.
             *delim = delimiter_;
-            warn(1652, "pin %s not found.", name);
+            warn(1652, "pin %s not found.", mapped_name);
           }
         }
         else {
@@ -496,11 +557,11 @@ SpefReader::findParasiticNode(char *name,
               int id = atoi(id_str);
               if (local_only
                   && !network_->isConnected(net, net_))
-                warn(1653, "%s not connected to net %s.", name, network_->pathName(net_));
+                warn(1653, "%s not connected to net %s.", mapped_name, network_->pathName(net_));
               return parasitics_->ensureParasiticNode(parasitic_, net, id, network_);
             }
             else
-              warn(1654, "node %s not a pin or net:number", name);
+              warn(1654, "node %s not a pin or net:number", mapped_name);
           }
         }
       }
@@ -16,7 +16,7 @@
 
 #pragma once
 
-#include <map>
+#include <unordered_map>
 
 #include "Zlib.hh"
 #include "StringSeq.hh"
@@ -41,7 +41,21 @@ class SpefRspfPi;
 class SpefTriple;
 class Corner;
 
-typedef std::map<int, char*, std::less<int>> SpefNameMap;
+// *NAME_MAP entry with the instance and net found for the name so
+// each name is only looked up in the network once.
+class SpefNameMapEntry
+{
+public:
+  SpefNameMapEntry();
+
+  char *name_;
+  Instance *inst_;
+  Net *net_;
+  bool inst_found_;
+  bool net_found_;
+};
+
+typedef std::unordered_map<int, SpefNameMapEntry> SpefNameMap;
 
 class SpefReader : public StaState
 {
@@ -124,6 +138,11 @@ private:
   Pin *findPortPinRelative(const char *name);
   Net *findNetRelative(const char *name);
   Instance *findInstanceRelative(const char *name);
+  SpefNameMapEntry *nameMapEntry(const char *name);
+  // Find the instance for name, which may be a name map reference.
+  Instance *findInstance(char *name,
+                         // Return value.
+                         char *&mapped_name);
   ParasiticNode *findParasiticNode(char *name,
                                    bool local_only);
 
@@ -509,8 +509,11 @@ Power::evalActivity(FuncExpr *expr,
 		    const Instance *inst)
 {
   LibertyPort *func_port = expr->port();
+  const FuncTruthTable *table = bddTruthTable(expr, inst);
   if (func_port &&  func_port->direction()->isInternal())
     return findSeqActivity(inst, func_port);
+  else if (table)
+    return evalTruthTableActivity(table, inst);
   else {
     DdNode *bdd = bdd_.funcBdd(expr);
     float duty = evalBddDuty(bdd, inst);
@@ -528,6 +531,9 @@ Power::evalDiffDuty(FuncExpr *expr,
                     LibertyPort *from_port,
                     const Instance *inst)
 {
+  const FuncTruthTable *table = bddTruthTable(expr, inst);
+  if (table)
+    return evalTruthTableDiffDuty(table, from_port, inst);
   DdNode *bdd = bdd_.funcBdd(expr);
   DdNode *var_node = bdd_.findNode(from_port);
   unsigned var_index = Cudd_NodeReadIndex(var_node);
@@ -541,6 +547,26 @@ Power::evalDiffDuty(FuncExpr *expr,
   return duty;
 }
 
+// The truth table gives the same duty and activity as the bdd when
+// every input is an instance pin. The bdd evaluators only take the
+// duty of internal ports (the activity of CK & IQ comes from CK alone)
+// and skip ports without a pin, so use the bdd for those.
+const FuncTruthTable *
+Power::bddTruthTable(FuncExpr *expr,
+                     const Instance *inst)
+{
+  const FuncTruthTable *table = expr->truthTable();
+  if (table) {
+    for (size_t i = 0; i < table->inputCount(); i++) {
+      LibertyPort *port = table->input(i);
+      if (port->direction()->isInternal()
+          || findLinkPin(inst, port) == nullptr)
+        return nullptr;
+    }
+  }
+  return table;
+}
+
 // As suggested by
 // https://stackoverflow.com/questions/63326728/cudd-printminterm-accessing-the-individual-minterms-in-the-sum-of-products
 float
@@ -617,6 +643,9 @@ PwrActivity
 Power::evalActivity(FuncExpr *expr,
 		    const Instance *inst)
 {
+  const FuncTruthTable *table = expr->truthTable();
+  if (table)
+    return evalTruthTableActivity(table, inst);
   return evalActivity(expr, inst, nullptr, true);
 }
 
@@ -706,6 +735,9 @@ Power::evalDiffDuty(FuncExpr *expr,
                     LibertyPort *cofactor_port,
                     const Instance *inst)
 {
+  const FuncTruthTable *table = expr->truthTable();
+  if (table)
+    return evalTruthTableDiffDuty(table, cofactor_port, inst);
   // Activity of positive/negative cofactors.
   PwrActivity pos = evalActivity(expr, inst, cofactor_port, true);
   PwrActivity neg = evalActivity(expr, inst, cofactor_port, false);
@@ -717,6 +749,84 @@ Power::evalDiffDuty(FuncExpr *expr,
 
 #endif // CUDD
 
+// Probability that the function is one for the minterms with
+// independent input duties.
+static float
+truthTableDuty(const FuncTruthTable *table,
+	       uint64_t minterms,
+	       const float *input_duties)
+{
+  float duty = 0.0;
+  for (size_t m = 0; m < table->mintermCount(); m++) {
+    if ((minterms >> m) & 1) {
+      float minterm_duty = 1.0;
+      for (size_t i = 0; i < table->inputCount(); i++) {
+	float input_duty = input_duties[i];
+	minterm_duty *= ((m >> i) & 1) ? input_duty : 1.0 - input_duty;
+      }
+      duty += minterm_duty;
+    }
+  }
+  return duty;
+}
+
+void
+Power::findTruthTableActivities(const FuncTruthTable *table,
+				const Instance *inst,
+				// Return value.
+				PwrActivity *activities)
+{
+  for (size_t i = 0; i < table->inputCount(); i++) {
+    LibertyPort *port = table->input(i);
+    if (port->direction()->isInternal())
+      activities[i] = findSeqActivity(inst, port);
+    else {
+      const Pin *pin = findLinkPin(inst, port);
+      if (pin)
+	activities[i] = findActivity(pin);
+      else
+	activities[i] = PwrActivity(0.0, 0.0, PwrActivityOrigin::constant);
+    }
+  }
+}
+
+// Activity is the sum of the input activities weighted by the duty of
+// the boolean difference of the function wrt each input.
+PwrActivity
+Power::evalTruthTableActivity(const FuncTruthTable *table,
+			      const Instance *inst)
+{
+  PwrActivity activities[FuncTruthTable::max_inputs];
+  float duties[FuncTruthTable::max_inputs];
+  findTruthTableActivities(table, inst, activities);
+  for (size_t i = 0; i < table->inputCount(); i++)
+    duties[i] = activities[i].duty();
+  float activity = 0.0;
+  for (size_t i = 0; i < table->inputCount(); i++) {
+    float diff_duty = truthTableDuty(table, table->sensitivity(i), duties);
+    activity += activities[i].activity() * diff_duty;
+  }
+  float duty = truthTableDuty(table, table->table(), duties);
+  return PwrActivity(activity, duty, PwrActivityOrigin::propagated);
+}
+
+// Find duty when from_port is sensitized.
+float
+Power::evalTruthTableDiffDuty(const FuncTruthTable *table,
+			      const LibertyPort *from_port,
+			      const Instance *inst)
+{
+  int from_index = table->inputIndex(from_port);
+  if (from_index == -1)
+    return 0.0;
+  PwrActivity activities[FuncTruthTable::max_inputs];
+  float duties[FuncTruthTable::max_inputs];
+  findTruthTableActivities(table, inst, activities);
+  for (size_t i = 0; i < table->inputCount(); i++)
+    duties[i] = activities[i].duty();
+  return truthTableDuty(table, table->sensitivity(from_index), duties);
+}
+
 ////////////////////////////////////////////////////////////////
 
 void
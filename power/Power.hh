@@ -36,6 +36,7 @@ class Corner;
 class DcalcAnalysisPt;
 class PropActivityVisitor;
 class BfsFwdIterator;
+class FuncTruthTable;
 class Vertex;
 
 typedef std::pair<const Instance*, LibertyPort*> SeqPin;
@@ -185,6 +186,15 @@ protected:
   float evalDiffDuty(FuncExpr *expr,
                      LibertyPort *from_port,
                      const Instance *inst);
+  PwrActivity evalTruthTableActivity(const FuncTruthTable *table,
+				     const Instance *inst);
+  float evalTruthTableDiffDuty(const FuncTruthTable *table,
+			       const LibertyPort *from_port,
+			       const Instance *inst);
+  void findTruthTableActivities(const FuncTruthTable *table,
+				const Instance *inst,
+				// Return value.
+				PwrActivity *activities);
   LibertyPort *findLinkPort(const LibertyCell *cell,
 			    const LibertyPort *corner_port);
   Pin *findLinkPin(const Instance *inst,
@@ -198,6 +208,8 @@ protected:
                         const Instance *inst);
   float evalBddDuty(DdNode *bdd,
                     const Instance *inst);
+  const FuncTruthTable *bddTruthTable(FuncExpr *expr,
+                                      const Instance *inst);
 
 private:
   // Port/pin activities set by set_pin_activity.
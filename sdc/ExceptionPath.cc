@@ -18,6 +18,7 @@
 #include "ExceptionPath.hh"
 
 #include <algorithm>
+#include <cstdint>
 
 #include "MinMax.hh"
 #include "TimingRole.hh"
@@ -955,6 +956,16 @@ ExceptionFromTo::allPins(const Network *network)
   return pins;
 }
 
+size_t
+ExceptionPt::idHash(size_t id)
+{
+  // splitmix64 finalizer.
+  uint64_t hash = id + 0x9e3779b97f4a7c15ull;
+  hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ull;
+  hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebull;
+  return hash ^ (hash >> 31);
+}
+
 void
 ExceptionFromTo::findHash(const Network *network)
 {
@@ -962,19 +973,19 @@ ExceptionFromTo::findHash(const Network *network)
   if (pins_) {
     size_t hash = 0;
     for (const Pin *pin : *pins_)
-      hash += network->id(pin);
+      hash += idHash(network->id(pin));
     hash_ += hash * hash_pin;
   }
   if (clks_) {
     size_t hash = 0;
     for (Clock *clk : *clks_)
-      hash += clk->index();
+      hash += idHash(clk->index());
     hash_ += hash * hash_clk;
   }
   if (insts_) {
     size_t hash = 0;
     for (const Instance *inst : *insts_)
-      hash += network->id(inst);
+      hash += idHash(network->id(inst));
     hash_ += hash * hash_inst;
   }
 }
@@ -1062,7 +1073,7 @@ ExceptionFromTo::addPin(const Pin *pin,
   if (!pins_->hasKey(pin)) {
     pins_->insert(pin);
     // Incrementally update hash.
-    hash_ += network->id(pin) * hash_pin;
+    hash_ += idHash(network->id(pin)) * hash_pin;
   }
 }
 
@@ -1074,7 +1085,7 @@ ExceptionFromTo::addClock(Clock *clk)
   if (!clks_->hasKey(clk)) {
     clks_->insert(clk);
     // Incrementally update hash.
-    hash_ += clk->index() * hash_clk;
+    hash_ += idHash(clk->index()) * hash_clk;
   }
 }
 
@@ -1087,7 +1098,7 @@ ExceptionFromTo::addInstance(const Instance *inst,
   if (!insts_->hasKey(inst)) {
     insts_->insert(inst);
     // Incrementally update hash.
-    hash_ += network->id(inst) * hash_inst;
+    hash_ += idHash(network->id(inst)) * hash_inst;
   }
 }
 
@@ -1098,7 +1109,7 @@ ExceptionFromTo::deletePin(const Pin *pin,
   if (pins_) {
     pins_->erase(pin);
     // Incrementally update hash.
-    hash_ -= network->id(pin) * hash_pin;
+    hash_ -= idHash(network->id(pin)) * hash_pin;
   }
 }
 
@@ -1108,7 +1119,7 @@ ExceptionFromTo::deleteClock(Clock *clk)
   if (clks_) {
     clks_->erase(clk);
     // Incrementally update hash.
-    hash_ -= clk->index() * hash_clk;
+    hash_ -= idHash(clk->index()) * hash_clk;
   }
 }
 
@@ -1119,7 +1130,7 @@ ExceptionFromTo::deleteInstance(const Instance *inst,
   if (insts_) {
     insts_->erase(inst);
     // Incrementally update hash.
-    hash_ -= network->id(inst) * hash_inst;
+    hash_ -= idHash(network->id(inst)) * hash_inst;
   }
 }
 
@@ -1698,7 +1709,7 @@ ExceptionThru::addPin(const Pin *pin,
   if (!pins_->hasKey(pin)) {
     pins_->insert(pin);
     // Incrementally update hash.
-    hash_ += network->id(pin) * hash_pin;
+    hash_ += idHash(network->id(pin)) * hash_pin;
   }
 }
 
@@ -1711,7 +1722,7 @@ ExceptionThru::addNet(const Net *net,
   if (!nets_->hasKey(net)) {
     nets_->insert(net);
     // Incrementally update hash.
-    hash_ += network->id(net) * hash_net;
+    hash_ += idHash(network->id(net)) * hash_net;
   }
 }
 
@@ -1724,7 +1735,7 @@ ExceptionThru::addInstance(const Instance *inst,
   if (!insts_->hasKey(inst)) {
     insts_->insert(inst);
     // Incrementally update hash.
-    hash_ += network->id(inst) * hash_inst;
+    hash_ += idHash(network->id(inst)) * hash_inst;
   }
 }
 
@@ -1745,7 +1756,7 @@ ExceptionThru::deletePin(const Pin *pin,
   if (pins_) {
     pins_->erase(pin);
     // Incrementally update hash.
-    hash_ -= network->id(pin) * hash_pin;
+    hash_ -= idHash(network->id(pin)) * hash_pin;
   }
 }
 
@@ -1756,7 +1767,7 @@ ExceptionThru::deleteNet(const Net *net,
   if (nets_) {
     nets_->erase(net);
     // Incrementally update hash.
-    hash_ -= network->id(net) * hash_net;
+    hash_ -= idHash(network->id(net)) * hash_net;
   }
 }
 
@@ -1767,7 +1778,7 @@ ExceptionThru::deleteInstance(const Instance *inst,
   if (insts_) {
     insts_->erase(inst);
     // Incrementally update hash.
-    hash_ -= network->id(inst) * hash_inst;
+    hash_ -= idHash(network->id(inst)) * hash_inst;
   }
 }
 
@@ -1831,19 +1842,19 @@ ExceptionThru::findHash(const Network *network)
   if (pins_) {
     size_t hash = 0;
     for (const Pin *pin : *pins_)
-      hash += network->id(pin);
+      hash += idHash(network->id(pin));
     hash_ += hash * hash_pin;
   }
   if (nets_) {
     size_t hash = 0;
     for (const Net *net : *nets_)
-      hash += network->id(net);
+      hash += idHash(network->id(net));
     hash_ += hash * hash_net;
   }
   if (insts_) {
     size_t hash = 0;
     for (const Instance *inst : *insts_)
-      hash += network->id(inst);
+      hash += idHash(network->id(inst));
     hash_ += hash * hash_inst;
   }
   hash_ += rf_->index() * 13;
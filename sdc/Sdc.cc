@@ -5234,8 +5234,9 @@ Sdc::exceptionThruStates(const Pin *from_pin,
 			 const MinMax *min_max) const
 {
   ExceptionStateSet *states = nullptr;
-  exceptionThruStates(first_thru_pin_exceptions_.findKey(to_pin),
-                      to_rf, min_max, states);
+  if (!first_thru_pin_exceptions_.empty())
+    exceptionThruStates(first_thru_pin_exceptions_.findKey(to_pin),
+                        to_rf, min_max, states);
   if (!first_thru_edge_exceptions_.empty()) {
     EdgePins edge_pins(from_pin, to_pin);
     exceptionThruStates(first_thru_edge_exceptions_.findKey(edge_pins),
@@ -0,0 +1,1039 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2024, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include "sdf/Checkpoint.hh"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "StaConfig.hh"  // STA_VERSION
+#include "Error.hh"
+#include "Report.hh"
+#include "UnorderedMap.hh"
+#include "TimingRole.hh"
+#include "TimingArc.hh"
+#include "Liberty.hh"
+#include "Network.hh"
+#include "Graph.hh"
+#include "Corner.hh"
+#include "Parasitics.hh"
+#include "GraphDelayCalc.hh"
+#include "Sta.hh"
+
+namespace sta {
+
+using std::string;
+
+// design.ckpt layout (native byte order).
+//   char[8]  magic
+//   string   sta version
+//   string   top cell name
+//   uint32   parasitic analysis point count
+//   uint32   dcalc analysis point count
+//   uint32   parasitic network count
+//   parasitic network records
+//     uint32   parasitic analysis point index
+//     string   net path name
+//     uint8    includes pin caps flag
+//     uint32   node count
+//     node records
+//       uint8    pin node flag
+//       string   pin path name or net path name
+//       uint32   net node id (net nodes only)
+//       float    ground capacitance
+//     uint32   resistor count
+//     resistor records
+//       uint32   id
+//       float    resistance
+//       uint32   node1 index
+//       uint32   node2 index
+//     uint32   coupling capacitor count
+//     coupling capacitor records (same as resistor records)
+//   uint32   pi/elmore model count
+//   pi/elmore model records
+//     uint32   parasitic analysis point index
+//     string   driver pin path name
+//     uint8    rise/fall index
+//     uint8    reduced from parasitic network flag
+//     float    c2, rpi, c1
+//     uint32   load count
+//     load records
+//       string   load pin path name
+//       float    elmore delay
+//   uint32   vertex count
+//   vertex records
+//     string   pin path name
+//     uint8    bidirect driver flag
+//     float    slews[ap_count][rise/fall]
+//     uint8    slew annotated flags[min/max][rise/fall]
+//   uint32   edge count
+//   edge records
+//     uint32   from vertex record index
+//     uint32   to vertex record index
+//     uint32   timing role index
+//     uint32   timing arc set index in cell
+//     uint32   arc count
+//     delay records[arc_count][ap_count]
+//       float    arc delay
+//       uint8    annotated flag
+// Strings are a uint32 length followed by the characters.
+// Parallel edges between the same pins (such as arcs that only differ
+// by their when condition) are distinguished by the arc set index.
+static const char checkpoint_magic[] = "STACKPT3";
+static const size_t checkpoint_magic_length = 8;
+
+static const char checkpoint_script_filename[] = "design.tcl";
+static const char checkpoint_data_filename[] = "design.ckpt";
+
+typedef UnorderedMap<const Vertex*, uint32_t> VertexIndexMap;
+typedef UnorderedMap<const ParasiticNode*, uint32_t> ParasiticNodeIndexMap;
+
+struct CheckpointParasiticNetwork
+{
+  const Net *net;
+  const ParasiticAnalysisPt *ap;
+  const Parasitic *parasitic;
+};
+
+typedef std::vector<CheckpointParasiticNetwork> CheckpointParasiticNetworkSeq;
+
+struct CheckpointPiElmore
+{
+  const Pin *drvr_pin;
+  const RiseFall *rf;
+  const ParasiticAnalysisPt *ap;
+  const Parasitic *parasitic;
+};
+
+typedef std::vector<CheckpointPiElmore> CheckpointPiElmoreSeq;
+
+class CheckpointWriter : public StaState
+{
+public:
+  CheckpointWriter(Sta *sta);
+  void write(const char *dirname,
+             const char *cwd);
+
+protected:
+  void writeScript(const char *cwd);
+  void writeLibraryReads(const char *cwd);
+  void writeHeader();
+  void findParasiticNetworks(const Instance *inst);
+  void writeParasiticNetworks();
+  void writeParasiticDevices(const ParasiticResistorSeq &resistors,
+                             const ParasiticNodeIndexMap &node_index_map);
+  void writeParasiticDevices(const ParasiticCapacitorSeq &capacitors,
+                             const ParasiticNodeIndexMap &node_index_map);
+  void findPiElmores();
+  void writePiElmores();
+  void writeVertices();
+  void writeEdges();
+  void writeUint8(uint8_t value);
+  void writeUint32(uint32_t value);
+  void writeFloat(float value);
+  void writeString(const char *str);
+  void writeString(const string &str);
+  void writeBytes(const void *buffer,
+                  size_t size);
+  void open(const string &filename);
+  void close();
+
+  string filename_;
+  FILE *stream_;
+  DcalcAPIndex ap_count_;
+  VertexIndexMap vertex_index_map_;
+  CheckpointParasiticNetworkSeq parasitic_networks_;
+  CheckpointPiElmoreSeq pi_elmores_;
+};
+
+struct CheckpointParasiticNode
+{
+  const Pin *pin;
+  const Net *net;
+  int id;
+  float cap;
+};
+
+struct CheckpointParasiticDevice
+{
+  size_t id;
+  float value;
+  uint32_t node1_index;
+  uint32_t node2_index;
+};
+
+typedef std::vector<CheckpointParasiticNode> CheckpointParasiticNodeSeq;
+typedef std::vector<CheckpointParasiticDevice> CheckpointParasiticDeviceSeq;
+
+struct CheckpointParasiticNetworkRecord
+{
+  const Net *net;
+  uint32_t ap_index;
+  bool includes_pin_caps;
+  CheckpointParasiticNodeSeq nodes;
+  CheckpointParasiticDeviceSeq resistors;
+  CheckpointParasiticDeviceSeq capacitors;
+};
+
+struct CheckpointElmore
+{
+  const Pin *load_pin;
+  float elmore;
+};
+
+struct CheckpointPiElmoreRecord
+{
+  const Pin *drvr_pin;
+  uint32_t ap_index;
+  const RiseFall *rf;
+  bool is_reduced;
+  float c2;
+  float rpi;
+  float c1;
+  std::vector<CheckpointElmore> elmores;
+};
+
+class CheckpointReader : public StaState
+{
+public:
+  CheckpointReader(const char *filename,
+                   Sta *sta);
+  bool read();
+
+protected:
+  void readHeader();
+  void readParasiticNetworks();
+  void readParasiticDevices(uint32_t node_count,
+                            CheckpointParasiticDeviceSeq &devices);
+  void readPiElmores();
+  void readVertices();
+  void readEdges();
+  void makeParasitics();
+  void annotate();
+  Edge *findEdge(Vertex *from,
+                 Vertex *to,
+                 uint32_t role_index,
+                 uint32_t arc_set_index,
+                 uint32_t arc_count);
+  uint32_t readApIndex();
+  uint8_t readUint8();
+  uint32_t readUint32();
+  float readFloat();
+  string readString();
+  void readBytes(void *buffer,
+                 size_t size);
+  void fileError(const char *msg);
+
+  Sta *sta_;
+  const char *filename_;
+  FILE *stream_;
+  DcalcAPIndex ap_count_;
+  uint32_t parasitic_ap_count_;
+  // The whole file is read before anything is annotated so a bad
+  // checkpoint leaves the design untouched.
+  std::vector<CheckpointParasiticNetworkRecord> parasitic_networks_;
+  std::vector<CheckpointPiElmoreRecord> pi_elmores_;
+  std::vector<Vertex*> vertices_;
+  // slews_[vertex_index][ap_count][rise/fall]
+  std::vector<float> slews_;
+  // slews_annotated_[vertex_index][min/max][rise/fall]
+  std::vector<uint8_t> slews_annotated_;
+  std::vector<Edge*> edges_;
+  // edge_delays_[edge_index][arc_count][ap_count]
+  std::vector<float> edge_delays_;
+  std::vector<uint8_t> edge_delays_annotated_;
+  size_t missing_vertex_count_;
+  size_t missing_edge_count_;
+  size_t missing_parasitic_count_;
+};
+
+void
+writeCheckpoint(const char *dirname,
+                const char *cwd,
+                Sta *sta)
+{
+  CheckpointWriter writer(sta);
+  writer.write(dirname, cwd);
+}
+
+bool
+readCheckpoint(const char *filename,
+               Sta *sta)
+{
+  CheckpointReader reader(filename, sta);
+  return reader.read();
+}
+
+////////////////////////////////////////////////////////////////
+
+CheckpointWriter::CheckpointWriter(Sta *sta) :
+  StaState(sta),
+  stream_(nullptr),
+  ap_count_(corners_->dcalcAnalysisPtCount())
+{
+}
+
+void
+CheckpointWriter::write(const char *dirname,
+                        const char *cwd)
+{
+  string dir = dirname;
+  open(dir + "/" + checkpoint_script_filename);
+  writeScript(cwd);
+  close();
+
+  findParasiticNetworks(network_->topInstance());
+  findPiElmores();
+  open(dir + "/" + checkpoint_data_filename);
+  writeHeader();
+  writeParasiticNetworks();
+  writePiElmores();
+  writeVertices();
+  writeEdges();
+  close();
+}
+
+// The script runs with checkpoint_dir set to the checkpoint directory.
+void
+CheckpointWriter::writeScript(const char *cwd)
+{
+  string script = "# OpenSTA ";
+  script += STA_VERSION;
+  script += " checkpoint\n";
+  script += "define_corners";
+  for (const Corner *corner : *corners_) {
+    script += " {";
+    script += corner->name();
+    script += "}";
+  }
+  script += "\n";
+  writeString(script);
+  writeLibraryReads(cwd);
+  script = "read_verilog [file join $checkpoint_dir netlist.v]\n";
+  script += "link_design {";
+  script += network_->name(network_->cell(network_->topInstance()));
+  script += "}\n";
+  script += "read_sdc [file join $checkpoint_dir constraints.sdc]\n";
+  writeString(script);
+}
+
+// Libraries are read in their original order so linking resolves
+// cells the same way.
+void
+CheckpointWriter::writeLibraryReads(const char *cwd)
+{
+  LibertyLibraryIterator *lib_iter = network_->libertyLibraryIterator();
+  while (lib_iter->hasNext()) {
+    LibertyLibrary *lib = lib_iter->next();
+    for (const Corner *corner : *corners_) {
+      const LibertySeq &min_libs = corner->libertyLibraries(MinMax::min());
+      const LibertySeq &max_libs = corner->libertyLibraries(MinMax::max());
+      bool is_min = std::find(min_libs.begin(), min_libs.end(), lib)
+        != min_libs.end();
+      bool is_max = std::find(max_libs.begin(), max_libs.end(), lib)
+        != max_libs.end();
+      if (is_min || is_max) {
+        string read = "read_liberty -corner {";
+        read += corner->name();
+        read += "}";
+        if (!is_max)
+          read += " -min";
+        else if (!is_min)
+          read += " -max";
+        read += " [file join {";
+        read += cwd;
+        read += "} {";
+        read += lib->filename();
+        read += "}]\n";
+        writeString(read);
+      }
+    }
+  }
+  delete lib_iter;
+}
+
+void
+CheckpointWriter::writeHeader()
+{
+  writeBytes(checkpoint_magic, checkpoint_magic_length);
+  writeString(STA_VERSION);
+  writeString(network_->name(network_->cell(network_->topInstance())));
+  writeUint32(corners_->parasiticAnalysisPtCount());
+  writeUint32(ap_count_);
+}
+
+void
+CheckpointWriter::findParasiticNetworks(const Instance *inst)
+{
+  ParasiticAnalysisPtSeq &aps = corners_->parasiticAnalysisPts();
+  NetIterator *net_iter = network_->netIterator(inst);
+  while (net_iter->hasNext()) {
+    const Net *net = net_iter->next();
+    for (const ParasiticAnalysisPt *ap : aps) {
+      const Parasitic *parasitic = parasitics_->findParasiticNetwork(net, ap);
+      // Min analysis points without their own network find the max one.
+      if (parasitic
+          && !(ap->index() != ap->indexMax()
+               && parasitic == parasitics_->findParasiticNetwork(net, aps[ap->indexMax()])))
+        parasitic_networks_.push_back({net, ap, parasitic});
+    }
+  }
+  delete net_iter;
+
+  InstanceChildIterator *child_iter = network_->childIterator(inst);
+  while (child_iter->hasNext()) {
+    const Instance *child = child_iter->next();
+    if (network_->isHierarchical(child))
+      findParasiticNetworks(child);
+  }
+  delete child_iter;
+}
+
+void
+CheckpointWriter::writeParasiticNetworks()
+{
+  writeUint32(parasitic_networks_.size());
+  for (const CheckpointParasiticNetwork &network : parasitic_networks_) {
+    const Parasitic *parasitic = network.parasitic;
+    writeUint32(network.ap->index());
+    writeString(network_->pathName(network.net));
+    writeUint8(parasitics_->includesPinCaps(parasitic));
+
+    ParasiticNodeSeq nodes = parasitics_->nodes(parasitic);
+    ParasiticNodeIndexMap node_index_map;
+    writeUint32(nodes.size());
+    for (const ParasiticNode *node : nodes) {
+      uint32_t node_index = node_index_map.size();
+      node_index_map[node] = node_index;
+      const Pin *pin = parasitics_->pin(node);
+      writeUint8(pin != nullptr);
+      if (pin)
+        writeString(network_->pathName(pin));
+      else {
+        const Net *net = parasitics_->net(node, network_);
+        writeString(network_->pathName(net));
+        // Net node names are net_path_name:id.
+        const char *name = parasitics_->name(node);
+        writeUint32(strtoul(strrchr(name, ':') + 1, nullptr, 10));
+      }
+      writeFloat(parasitics_->nodeGndCap(node));
+    }
+    writeParasiticDevices(parasitics_->resistors(parasitic), node_index_map);
+    writeParasiticDevices(parasitics_->capacitors(parasitic), node_index_map);
+  }
+}
+
+void
+CheckpointWriter::writeParasiticDevices(const ParasiticResistorSeq &resistors,
+                                        const ParasiticNodeIndexMap &node_index_map)
+{
+  writeUint32(resistors.size());
+  for (const ParasiticResistor *resistor : resistors) {
+    writeUint32(parasitics_->id(resistor));
+    writeFloat(parasitics_->value(resistor));
+    writeUint32(node_index_map.at(parasitics_->node1(resistor)));
+    writeUint32(node_index_map.at(parasitics_->node2(resistor)));
+  }
+}
+
+void
+CheckpointWriter::writeParasiticDevices(const ParasiticCapacitorSeq &capacitors,
+                                        const ParasiticNodeIndexMap &node_index_map)
+{
+  writeUint32(capacitors.size());
+  for (const ParasiticCapacitor *capacitor : capacitors) {
+    writeUint32(parasitics_->id(capacitor));
+    writeFloat(parasitics_->value(capacitor));
+    writeUint32(node_index_map.at(parasitics_->node1(capacitor)));
+    writeUint32(node_index_map.at(parasitics_->node2(capacitor)));
+  }
+}
+
+// Pi/elmore models on nets with a parasitic network are reduced from
+// the network on demand, so only the models without one are saved
+// (read_spef -reduce, set_pi_model).
+void
+CheckpointWriter::findPiElmores()
+{
+  VertexIterator vertex_iter(graph_);
+  while (vertex_iter.hasNext()) {
+    Vertex *vertex = vertex_iter.next();
+    const Pin *pin = vertex->pin();
+    if (!vertex->isBidirectDriver()
+        && network_->isDriver(pin)) {
+      for (const ParasiticAnalysisPt *ap : corners_->parasiticAnalysisPts()) {
+        if (parasitics_->findParasiticNetwork(pin, ap) == nullptr) {
+          for (const RiseFall *rf : RiseFall::range()) {
+            const Parasitic *parasitic = parasitics_->findPiElmore(pin, rf, ap);
+            if (parasitic)
+              pi_elmores_.push_back({pin, rf, ap, parasitic});
+          }
+        }
+      }
+    }
+  }
+}
+
+void
+CheckpointWriter::writePiElmores()
+{
+  writeUint32(pi_elmores_.size());
+  for (const CheckpointPiElmore &pi_elmore : pi_elmores_) {
+    const Parasitic *parasitic = pi_elmore.parasitic;
+    writeUint32(pi_elmore.ap->index());
+    writeString(network_->pathName(pi_elmore.drvr_pin));
+    writeUint8(pi_elmore.rf->index());
+    writeUint8(parasitics_->isReducedParasiticNetwork(parasitic));
+    float c2, rpi, c1;
+    parasitics_->piModel(parasitic, c2, rpi, c1);
+    writeFloat(c2);
+    writeFloat(rpi);
+    writeFloat(c1);
+
+    PinSet loads = parasitics_->loads(pi_elmore.drvr_pin);
+    std::vector<CheckpointElmore> elmores;
+    for (const Pin *load_pin : loads) {
+      float elmore;
+      bool exists;
+      parasitics_->findElmore(parasitic, load_pin, elmore, exists);
+      if (exists)
+        elmores.push_back({load_pin, elmore});
+    }
+    writeUint32(elmores.size());
+    for (const CheckpointElmore &elmore : elmores) {
+      writeString(network_->pathName(elmore.load_pin));
+      writeFloat(elmore.elmore);
+    }
+  }
+}
+
+void
+CheckpointWriter::writeVertices()
+{
+  writeUint32(graph_->vertexCount());
+  uint32_t vertex_index = 0;
+  VertexIterator vertex_iter(graph_);
+  while (vertex_iter.hasNext()) {
+    Vertex *vertex = vertex_iter.next();
+    vertex_index_map_[vertex] = vertex_index++;
+    writeString(network_->pathName(vertex->pin()));
+    writeUint8(vertex->isBidirectDriver());
+    for (DcalcAPIndex ap_index = 0; ap_index < ap_count_; ap_index++) {
+      for (const RiseFall *rf : RiseFall::range())
+        writeFloat(delayAsFloat(graph_->slew(vertex, rf, ap_index)));
+    }
+    // Vertices only track slew annotations by min/max.
+    for (const MinMax *min_max : MinMax::range()) {
+      for (const RiseFall *rf : RiseFall::range())
+        writeUint8(vertex->slewAnnotated(rf, min_max));
+    }
+  }
+}
+
+void
+CheckpointWriter::writeEdges()
+{
+  writeUint32(graph_->edgeCount());
+  VertexIterator vertex_iter(graph_);
+  while (vertex_iter.hasNext()) {
+    Vertex *vertex = vertex_iter.next();
+    uint32_t from_index = vertex_index_map_[vertex];
+    VertexOutEdgeIterator edge_iter(vertex, graph_);
+    while (edge_iter.hasNext()) {
+      Edge *edge = edge_iter.next();
+      const TimingArcSet *arc_set = edge->timingArcSet();
+      writeUint32(from_index);
+      writeUint32(vertex_index_map_[edge->to(graph_)]);
+      writeUint32(edge->role()->index());
+      writeUint32(arc_set->index());
+      writeUint32(arc_set->arcCount());
+      for (TimingArc *arc : arc_set->arcs()) {
+        for (DcalcAPIndex ap_index = 0; ap_index < ap_count_; ap_index++) {
+          writeFloat(delayAsFloat(graph_->arcDelay(edge, arc, ap_index)));
+          writeUint8(graph_->arcDelayAnnotated(edge, arc, ap_index));
+        }
+      }
+    }
+  }
+}
+
+void
+CheckpointWriter::writeUint8(uint8_t value)
+{
+  writeBytes(&value, sizeof(value));
+}
+
+void
+CheckpointWriter::writeUint32(uint32_t value)
+{
+  writeBytes(&value, sizeof(value));
+}
+
+void
+CheckpointWriter::writeFloat(float value)
+{
+  writeBytes(&value, sizeof(value));
+}
+
+void
+CheckpointWriter::writeString(const char *str)
+{
+  uint32_t length = strlen(str);
+  writeUint32(length);
+  writeBytes(str, length);
+}
+
+// Script text is written without a length prefix.
+void
+CheckpointWriter::writeString(const string &str)
+{
+  writeBytes(str.c_str(), str.size());
+}
+
+void
+CheckpointWriter::writeBytes(const void *buffer,
+                             size_t size)
+{
+  if (size > 0
+      && fwrite(buffer, 1, size, stream_) != size) {
+    fclose(stream_);
+    stream_ = nullptr;
+    throw FileNotWritable(filename_.c_str());
+  }
+}
+
+void
+CheckpointWriter::open(const string &filename)
+{
+  filename_ = filename;
+  stream_ = fopen(filename_.c_str(), "wb");
+  if (stream_ == nullptr)
+    throw FileNotWritable(filename_.c_str());
+}
+
+void
+CheckpointWriter::close()
+{
+  // Buffered write errors show up when the stream is flushed.
+  int status = fclose(stream_);
+  stream_ = nullptr;
+  if (status != 0)
+    throw FileNotWritable(filename_.c_str());
+}
+
+////////////////////////////////////////////////////////////////
+
+CheckpointReader::CheckpointReader(const char *filename,
+                                   Sta *sta) :
+  StaState(sta),
+  sta_(sta),
+  filename_(filename),
+  stream_(nullptr),
+  ap_count_(corners_->dcalcAnalysisPtCount()),
+  parasitic_ap_count_(0),
+  missing_vertex_count_(0),
+  missing_edge_count_(0),
+  missing_parasitic_count_(0)
+{
+}
+
+bool
+CheckpointReader::read()
+{
+  stream_ = fopen(filename_, "rb");
+  if (stream_ == nullptr)
+    throw FileNotReadable(filename_);
+  readHeader();
+  readParasiticNetworks();
+  readPiElmores();
+  readVertices();
+  readEdges();
+  fclose(stream_);
+  stream_ = nullptr;
+  makeParasitics();
+  annotate();
+
+  bool complete = missing_vertex_count_ == 0
+    && missing_edge_count_ == 0
+    && missing_parasitic_count_ == 0;
+  if (complete)
+    // Restored delays are valid results that later edits invalidate
+    // incrementally.
+    graph_delay_calc_->delaysRestored();
+  else {
+    report_->warn(626, "%s %zu pins, %zu edges and %zu parasitics not found.",
+                  filename_,
+                  missing_vertex_count_,
+                  missing_edge_count_,
+                  missing_parasitic_count_);
+    graph_delay_calc_->delaysInvalid();
+  }
+  return complete;
+}
+
+void
+CheckpointReader::readHeader()
+{
+  char magic[checkpoint_magic_length];
+  readBytes(magic, checkpoint_magic_length);
+  if (memcmp(magic, checkpoint_magic, checkpoint_magic_length) != 0)
+    fileError("is not a checkpoint file.");
+  string version = readString();
+  if (version != STA_VERSION)
+    fileError("was written by a different OpenSTA version.");
+  string top_cell_name = readString();
+  const char *design_name = network_->name(network_->cell(network_->topInstance()));
+  if (top_cell_name != design_name)
+    fileError("design does not match the top level cell name.");
+  parasitic_ap_count_ = readUint32();
+  // Parasitics are per corner if there are more analysis points than
+  // min/max.
+  if (parasitic_ap_count_ != MinMax::index_count
+      && parasitic_ap_count_ != static_cast<uint32_t>(corners_->count()
+                                                      * MinMax::index_count))
+    fileError("parasitic corners do not match the current corners.");
+  if (readUint32() != static_cast<uint32_t>(ap_count_))
+    fileError("corner count does not match the current corners.");
+}
+
+void
+CheckpointReader::readParasiticNetworks()
+{
+  uint32_t network_count = readUint32();
+  parasitic_networks_.resize(network_count);
+  for (CheckpointParasiticNetworkRecord &network : parasitic_networks_) {
+    network.ap_index = readApIndex();
+    string net_name = readString();
+    network.net = network_->findNet(net_name.c_str());
+    network.includes_pin_caps = readUint8();
+    bool missing = network.net == nullptr;
+    uint32_t node_count = readUint32();
+    network.nodes.resize(node_count);
+    for (CheckpointParasiticNode &node : network.nodes) {
+      bool is_pin = readUint8();
+      string name = readString();
+      node.pin = nullptr;
+      node.net = nullptr;
+      node.id = 0;
+      if (is_pin) {
+        node.pin = network_->findPin(name.c_str());
+        missing |= node.pin == nullptr;
+      }
+      else {
+        node.net = network_->findNet(name.c_str());
+        node.id = readUint32();
+        missing |= node.net == nullptr;
+      }
+      node.cap = readFloat();
+    }
+    readParasiticDevices(node_count, network.resistors);
+    readParasiticDevices(node_count, network.capacitors);
+    if (missing) {
+      network.net = nullptr;
+      missing_parasitic_count_++;
+    }
+  }
+}
+
+void
+CheckpointReader::readParasiticDevices(uint32_t node_count,
+                                       CheckpointParasiticDeviceSeq &devices)
+{
+  uint32_t device_count = readUint32();
+  devices.resize(device_count);
+  for (CheckpointParasiticDevice &device : devices) {
+    device.id = readUint32();
+    device.value = readFloat();
+    device.node1_index = readUint32();
+    device.node2_index = readUint32();
+    if (device.node1_index >= node_count
+        || device.node2_index >= node_count)
+      fileError("is corrupted.");
+  }
+}
+
+void
+CheckpointReader::readPiElmores()
+{
+  uint32_t pi_elmore_count = readUint32();
+  pi_elmores_.resize(pi_elmore_count);
+  for (CheckpointPiElmoreRecord &pi_elmore : pi_elmores_) {
+    pi_elmore.ap_index = readApIndex();
+    string drvr_pin_name = readString();
+    pi_elmore.drvr_pin = network_->findPin(drvr_pin_name.c_str());
+    uint8_t rf_index = readUint8();
+    if (rf_index >= RiseFall::index_count)
+      fileError("is corrupted.");
+    pi_elmore.rf = RiseFall::find(rf_index);
+    pi_elmore.is_reduced = readUint8();
+    pi_elmore.c2 = readFloat();
+    pi_elmore.rpi = readFloat();
+    pi_elmore.c1 = readFloat();
+    bool missing = pi_elmore.drvr_pin == nullptr;
+    uint32_t load_count = readUint32();
+    pi_elmore.elmores.resize(load_count);
+    for (CheckpointElmore &elmore : pi_elmore.elmores) {
+      string load_pin_name = readString();
+      elmore.load_pin = network_->findPin(load_pin_name.c_str());
+      elmore.elmore = readFloat();
+      missing |= elmore.load_pin == nullptr;
+    }
+    if (missing) {
+      pi_elmore.drvr_pin = nullptr;
+      missing_parasitic_count_++;
+    }
+  }
+}
+
+void
+CheckpointReader::readVertices()
+{
+  uint32_t vertex_count = readUint32();
+  if (vertex_count != graph_->vertexCount())
+    fileError("pin count does not match the design.");
+  vertices_.resize(vertex_count);
+  slews_.reserve(vertex_count * ap_count_ * RiseFall::index_count);
+  slews_annotated_.reserve(vertex_count * MinMax::index_count
+                           * RiseFall::index_count);
+  for (uint32_t i = 0; i < vertex_count; i++) {
+    string pin_name = readString();
+    bool is_bidirect_drvr = readUint8();
+    Vertex *vertex = nullptr;
+    Pin *pin = network_->findPin(pin_name.c_str());
+    if (pin) {
+      if (is_bidirect_drvr)
+        vertex = graph_->pinDrvrVertex(pin);
+      else
+        vertex = graph_->pinLoadVertex(pin);
+    }
+    vertices_[i] = vertex;
+    if (vertex == nullptr)
+      missing_vertex_count_++;
+    for (DcalcAPIndex ap_index = 0; ap_index < ap_count_; ap_index++) {
+      for (int rf_index = 0; rf_index < RiseFall::index_count; rf_index++)
+        slews_.push_back(readFloat());
+    }
+    for (int mm_index = 0; mm_index < MinMax::index_count; mm_index++) {
+      for (int rf_index = 0; rf_index < RiseFall::index_count; rf_index++)
+        slews_annotated_.push_back(readUint8());
+    }
+  }
+}
+
+void
+CheckpointReader::readEdges()
+{
+  uint32_t edge_count = readUint32();
+  for (uint32_t i = 0; i < edge_count; i++) {
+    uint32_t from_index = readUint32();
+    uint32_t to_index = readUint32();
+    uint32_t role_index = readUint32();
+    uint32_t arc_set_index = readUint32();
+    uint32_t arc_count = readUint32();
+    if (from_index >= vertices_.size()
+        || to_index >= vertices_.size()
+        || role_index > static_cast<uint32_t>(TimingRole::index_max))
+      fileError("is corrupted.");
+    Vertex *from = vertices_[from_index];
+    Vertex *to = vertices_[to_index];
+    Edge *edge = nullptr;
+    if (from && to)
+      edge = findEdge(from, to, role_index, arc_set_index, arc_count);
+    if (edge)
+      edges_.push_back(edge);
+    else
+      missing_edge_count_++;
+    for (uint32_t arc_index = 0; arc_index < arc_count; arc_index++) {
+      for (DcalcAPIndex ap_index = 0; ap_index < ap_count_; ap_index++) {
+        float delay = readFloat();
+        uint8_t annotated = readUint8();
+        if (edge) {
+          edge_delays_.push_back(delay);
+          edge_delays_annotated_.push_back(annotated);
+        }
+      }
+    }
+  }
+}
+
+void
+CheckpointReader::makeParasitics()
+{
+  sta_->setParasiticAnalysisPts(parasitic_ap_count_ != MinMax::index_count);
+  ParasiticAnalysisPtSeq &aps = corners_->parasiticAnalysisPts();
+  for (const CheckpointParasiticNetworkRecord &network : parasitic_networks_) {
+    if (network.net) {
+      const ParasiticAnalysisPt *ap = aps[network.ap_index];
+      Parasitic *parasitic =
+        parasitics_->makeParasiticNetwork(network.net,
+                                          network.includes_pin_caps, ap);
+      std::vector<ParasiticNode*> nodes;
+      nodes.reserve(network.nodes.size());
+      for (const CheckpointParasiticNode &node : network.nodes) {
+        ParasiticNode *pnode = node.pin
+          ? parasitics_->ensureParasiticNode(parasitic, node.pin, network_)
+          : parasitics_->ensureParasiticNode(parasitic, node.net, node.id,
+                                             network_);
+        parasitics_->incrCap(pnode, node.cap);
+        nodes.push_back(pnode);
+      }
+      for (const CheckpointParasiticDevice &resistor : network.resistors)
+        parasitics_->makeResistor(parasitic, resistor.id, resistor.value,
+                                  nodes[resistor.node1_index],
+                                  nodes[resistor.node2_index]);
+      for (const CheckpointParasiticDevice &capacitor : network.capacitors)
+        parasitics_->makeCapacitor(parasitic, capacitor.id, capacitor.value,
+                                   nodes[capacitor.node1_index],
+                                   nodes[capacitor.node2_index]);
+    }
+  }
+
+  for (const CheckpointPiElmoreRecord &pi_elmore : pi_elmores_) {
+    if (pi_elmore.drvr_pin) {
+      const ParasiticAnalysisPt *ap = aps[pi_elmore.ap_index];
+      Parasitic *parasitic = parasitics_->makePiElmore(pi_elmore.drvr_pin,
+                                                       pi_elmore.rf, ap,
+                                                       pi_elmore.c2,
+                                                       pi_elmore.rpi,
+                                                       pi_elmore.c1);
+      parasitics_->setIsReducedParasiticNetwork(parasitic,
+                                                pi_elmore.is_reduced);
+      for (const CheckpointElmore &elmore : pi_elmore.elmores)
+        parasitics_->setElmore(parasitic, elmore.load_pin, elmore.elmore);
+    }
+  }
+}
+
+void
+CheckpointReader::annotate()
+{
+  size_t slew_index = 0;
+  size_t slew_annotated_index = 0;
+  for (Vertex *vertex : vertices_) {
+    for (DcalcAPIndex ap_index = 0; ap_index < ap_count_; ap_index++) {
+      for (const RiseFall *rf : RiseFall::range()) {
+        float slew = slews_[slew_index++];
+        if (vertex)
+          graph_->setSlew(vertex, rf, ap_index, slew);
+      }
+    }
+    for (const MinMax *min_max : MinMax::range()) {
+      for (const RiseFall *rf : RiseFall::range()) {
+        bool annotated = slews_annotated_[slew_annotated_index++];
+        if (vertex)
+          vertex->setSlewAnnotated(annotated, rf, min_max->index());
+      }
+    }
+  }
+
+  size_t delay_index = 0;
+  for (Edge *edge : edges_) {
+    for (const TimingArc *arc : edge->timingArcSet()->arcs()) {
+      for (DcalcAPIndex ap_index = 0; ap_index < ap_count_; ap_index++) {
+        graph_->setArcDelay(edge, arc, ap_index, edge_delays_[delay_index]);
+        graph_->setArcDelayAnnotated(edge, arc, ap_index,
+                                     edge_delays_annotated_[delay_index]);
+        delay_index++;
+      }
+    }
+  }
+}
+
+Edge *
+CheckpointReader::findEdge(Vertex *from,
+                           Vertex *to,
+                           uint32_t role_index,
+                           uint32_t arc_set_index,
+                           uint32_t arc_count)
+{
+  VertexOutEdgeIterator edge_iter(from, graph_);
+  while (edge_iter.hasNext()) {
+    Edge *edge = edge_iter.next();
+    const TimingArcSet *arc_set = edge->timingArcSet();
+    if (edge->to(graph_) == to
+        && static_cast<uint32_t>(edge->role()->index()) == role_index
+        && static_cast<uint32_t>(arc_set->index()) == arc_set_index
+        && arc_set->arcCount() == arc_count)
+      return edge;
+  }
+  return nullptr;
+}
+
+uint32_t
+CheckpointReader::readApIndex()
+{
+  uint32_t ap_index = readUint32();
+  if (ap_index >= parasitic_ap_count_)
+    fileError("is corrupted.");
+  return ap_index;
+}
+
+uint8_t
+CheckpointReader::readUint8()
+{
+  uint8_t value;
+  readBytes(&value, sizeof(value));
+  return value;
+}
+
+uint32_t
+CheckpointReader::readUint32()
+{
+  uint32_t value;
+  readBytes(&value, sizeof(value));
+  return value;
+}
+
+float
+CheckpointReader::readFloat()
+{
+  float value;
+  readBytes(&value, sizeof(value));
+  return value;
+}
+
+string
+CheckpointReader::readString()
+{
+  uint32_t length = readUint32();
+  string str(length, '\0');
+  if (length > 0)
+    readBytes(&str[0], length);
+  return str;
+}
+
+void
+CheckpointReader::readBytes(void *buffer,
+                            size_t size)
+{
+  if (fread(buffer, 1, size, stream_) != size)
+    fileError("is truncated.");
+}
+
+void
+CheckpointReader::fileError(const char *msg)
+{
+  fclose(stream_);
+  stream_ = nullptr;
+  report_->error(625, "checkpoint %s %s", filename_, msg);
+}
+
+} // namespace
@@ -0,0 +1,53 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2024, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+namespace sta {
+
+class Sta;
+
+// A checkpoint is a directory that holds everything needed to re-time
+// a design without repeating delay calculation.
+//   design.tcl       define_corners, read_liberty, read_verilog,
+//                    link_design and read_sdc commands
+//   netlist.v        write_verilog netlist
+//   constraints.sdc  write_sdc constraints
+//   design.ckpt      parasitics and delay calculation results
+// The read_checkpoint command sources design.tcl and then calls
+// readCheckpoint on design.ckpt.
+//
+// Liberty files are referenced by their absolute file names, not
+// copied. Parasitic networks and pi/elmore models without a parasitic
+// network are saved; pi/pole-residue models are not. Slews and arc
+// delays are restored with their original annotation flags and delay
+// calculation resumes incrementally, so later netlist, constraint or
+// parasitic edits recompute the delays they invalidate.
+
+// Write the design.tcl script and design.ckpt to dirname.
+// Relative liberty file names are resolved against cwd.
+void
+writeCheckpoint(const char *dirname,
+                const char *cwd,
+                Sta *sta);
+
+// Read design.ckpt after the design.tcl script has been sourced.
+// Return true if successful.
+bool
+readCheckpoint(const char *filename,
+               Sta *sta);
+
+} // namespace
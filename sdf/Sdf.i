@@ -21,6 +21,7 @@
 #include "sdf/SdfReader.hh"
 #include "sdf/ReportAnnotation.hh"
 #include "sdf/SdfWriter.hh"
+#include "sdf/Checkpoint.hh"
 #include "Search.hh"
 #include "Sta.hh"
 
@@ -33,6 +34,8 @@ using sta::stringEq;
 using sta::readSdf;
 using sta::reportAnnotatedDelay;
 using sta::reportAnnotatedCheck;
+using sta::writeCheckpoint;
+using sta::readCheckpoint;
 
 %}
 
@@ -123,4 +126,26 @@ write_sdf_cmd(char *filename,
 		no_timestamp, no_version);
 }
 
+void
+write_checkpoint_cmd(const char *dirname,
+                     const char *cwd)
+{
+  cmdLinkedNetwork();
+  Sta *sta = Sta::sta();
+  sta->findDelays();
+  writeCheckpoint(dirname, cwd, sta);
+}
+
+// Return true if successful.
+bool
+read_checkpoint_cmd(const char *filename)
+{
+  cmdLinkedNetwork();
+  Sta *sta = Sta::sta();
+  sta->ensureLevelized();
+  bool success = readCheckpoint(filename, sta);
+  sta->search()->arrivalsInvalid();
+  return success;
+}
+
 %} // inline
@@ -168,5 +168,32 @@ proc_redirect write_sdf {
     $no_timestamp $no_version
 }
 
+################################################################
+
+define_cmd_args "write_checkpoint" {dirname}
+
+proc_redirect write_checkpoint {
+  check_argc_eq1 "write_checkpoint" $args
+  set checkpoint_dir [file nativename [lindex $args 0]]
+  file mkdir $checkpoint_dir
+  write_verilog [file join $checkpoint_dir netlist.v]
+  write_sdc [file join $checkpoint_dir constraints.sdc]
+  write_checkpoint_cmd $checkpoint_dir [pwd]
+}
+
+define_cmd_args "read_checkpoint" {dirname}
+
+# The checkpoint reads the libraries and netlist so it has to be
+# read before any libraries.
+proc_redirect read_checkpoint {
+  check_argc_eq1 "read_checkpoint" $args
+  set checkpoint_dir [file nativename [lindex $args 0]]
+  if { [get_libs -quiet *] != {} } {
+    sta_error 627 "read_checkpoint must be called before read_liberty."
+  }
+  source [file join $checkpoint_dir design.tcl]
+  read_checkpoint_cmd [file join $checkpoint_dir design.ckpt]
+}
+
 # sta namespace end
 }
@@ -1029,14 +1029,19 @@ SdfReader::sdfError(int id,
 Pin *
 SdfReader::findPin(const char *name)
 {
-  if (path_) {
-    string path_name;
+  string path_name = name;
+  if (path_)
     stringPrint(path_name, "%s%c%s", path_, divider_, name);
-    Pin *pin = network_->findPin(path_name.c_str());
-    return pin;
+  Pin *pin = nullptr;
+  size_t divider = lastDivider(path_name);
+  if (divider != string::npos) {
+    Instance *inst = findInstance1(path_name.substr(0, divider));
+    if (inst)
+      pin = network_->findPin(inst, path_name.c_str() + divider + 1);
   }
-  else
-    return network_->findPin(name);
+  if (pin == nullptr)
+    pin = network_->findPin(path_name.c_str());
+  return pin;
 }
 
 Instance *
@@ -1045,12 +1050,61 @@ SdfReader::findInstance(const char *name)
   string inst_name = name;
   if (path_)
     stringPrint(inst_name, "%s%c%s", path_, divider_, name);
-  Instance *inst = network_->findInstance(inst_name.c_str());
+  Instance *inst = findInstance1(inst_name);
   if (inst == nullptr)
     sdfWarn(195, "instance %s not found.", inst_name.c_str());
   return inst;
 }
 
+// Find the parent instance through parent_instances_ and the child by
+// name instead of walking the hierarchy from the top for every path.
+Instance *
+SdfReader::findInstance1(const string &path_name)
+{
+  Instance *inst = nullptr;
+  size_t divider = lastDivider(path_name);
+  if (divider != string::npos) {
+    Instance *parent = findParentInstance(path_name.substr(0, divider));
+    if (parent)
+      inst = network_->findChild(parent, path_name.c_str() + divider + 1);
+  }
+  if (inst == nullptr)
+    inst = network_->findInstance(path_name.c_str());
+  return inst;
+}
+
+Instance *
+SdfReader::findParentInstance(const string &path_name)
+{
+  auto parent_itr = parent_instances_.find(path_name);
+  if (parent_itr != parent_instances_.end())
+    return parent_itr->second;
+  else {
+    Instance *parent = findInstance1(path_name);
+    parent_instances_[path_name] = parent;
+    return parent;
+  }
+}
+
+// Position of the last unescaped network divider in path_name.
+size_t
+SdfReader::lastDivider(const string &path_name)
+{
+  char path_escape = network_->pathEscape();
+  char path_divider = network_->pathDivider();
+  size_t divider = string::npos;
+  size_t length = path_name.size();
+  for (size_t i = 0; i < length; i++) {
+    char ch = path_name[i];
+    if (ch == path_escape)
+      // Skip the escaped character.
+      i++;
+    else if (ch == path_divider)
+      divider = i;
+  }
+  return divider;
+}
+
 ////////////////////////////////////////////////////////////////
 
 SdfPortSpec::SdfPortSpec(Transition *tr,
@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <string>
+
 #include "Zlib.hh"
 #include "Vector.hh"
+#include "UnorderedMap.hh"
 #include "TimingRole.hh"
 #include "Transition.hh"
 #include "LibertyClass.hh"
@@ -42,6 +45,7 @@ class SdfTriple;
 class SdfPortSpec;
 
 typedef Vector<SdfTriple*> SdfTripleSeq;
+typedef UnorderedMap<std::string, Instance*> SdfInstanceMap;
 
 class SdfReader : public StaState
 {
@@ -192,6 +196,9 @@ private:
   void deletePortSpec(SdfPortSpec *edge);
   Pin *findPin(const char *name);
   Instance *findInstance(const char *name);
+  Instance *findInstance1(const std::string &path_name);
+  Instance *findParentInstance(const std::string &path_name);
+  size_t lastDivider(const std::string &path_name);
   void setEdgeDelays(Edge *edge,
 		     SdfTripleSeq *triples,
 		     const char *sdf_cmd);
@@ -219,6 +226,10 @@ private:
   char escape_;
   Instance *instance_;
   const char *cell_name_;
+  // Hierarchical instances found by path name. SDF files list every
+  // cell and interconnect with its full path, so most lookups share
+  // the same parent instances.
+  SdfInstanceMap parent_instances_;
   bool in_timing_check_;
   bool in_incremental_;
   float timescale_;
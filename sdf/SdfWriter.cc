@@ -17,11 +17,18 @@
 #include "sdf/SdfWriter.hh"
 
 #include <cstdio>
+#include <cstdarg>
+#include <cstring>
 #include <ctime>
+#include <algorithm>
+#include <atomic>
 
 #include "Zlib.hh"
 #include "StaConfig.hh"  // STA_VERSION
+#include "Machine.hh"
+#include "DispatchQueue.hh"
 #include "Fuzzy.hh"
+#include "Report.hh"
 #include "StringUtil.hh"
 #include "Units.hh"
 #include "TimingRole.hh"
@@ -43,7 +50,6 @@ class SdfWriter : public StaState
 {
 public:
   SdfWriter(StaState *sta);
-  ~SdfWriter();
   void write(const char *filename,
 	     Corner *corner,
 	     char sdf_divider,
@@ -59,10 +65,26 @@ protected:
 		   bool no_version);
   void writeTrailer();
   void writeInterconnects();
-  void writeInstInterconnects(Instance *inst);
+  void writeInstInterconnects(const Instance *inst);
   void writeInterconnectFromPin(Pin *drvr_pin);
 
   void writeInstances();
+  void writeInstance(const Instance *inst);
+  void writeInstChunks(const InstanceSeq &insts,
+                       bool interconnects);
+  bool writeInstChunk(const InstanceSeq &insts,
+                      size_t chunk_index,
+                      bool interconnects,
+                      // Return value.
+                      string &chunk);
+  void print(const char *fmt,
+             ...)
+    __attribute__((format (printf, 2, 3)));
+  void flushBuffer();
+  bool compressBuffer(// Return value.
+                      string &chunk);
+  void compressError();
+  void writeChunk(const string &chunk);
   void writeInstHeader(const Instance *inst);
   void writeInstTrailer();
   void writeIopaths(const Instance *inst,
@@ -112,9 +134,13 @@ private:
 
   char sdf_escape_;
   char network_escape_;
-  char *delay_format_;
+  int digits_;
+  bool gzip_;
 
-  gzFile stream_;
+  const char *filename_;
+  FILE *stream_;
+  // Text that has not been written to stream_ yet.
+  string buffer_;
   const Corner *corner_;
   int arc_delay_min_index_;
   int arc_delay_max_index_;
@@ -140,15 +166,13 @@ SdfWriter::SdfWriter(StaState *sta) :
   StaState(sta),
   sdf_escape_('\\'),
   network_escape_(network_->pathEscape()),
-  delay_format_(nullptr)
+  digits_(0),
+  gzip_(false),
+  filename_(nullptr),
+  stream_(nullptr)
 {
 }
 
-SdfWriter::~SdfWriter()
-{
-  stringDelete(delay_format_);
-}
-
 void
 SdfWriter::write(const char *filename,
 		 Corner *corner,
@@ -161,8 +185,10 @@ SdfWriter::write(const char *filename,
 {
   sdf_divider_ = sdf_divider;
   include_typ_ = include_typ;
-  if (delay_format_ == nullptr)
-    delay_format_ = stringPrint("%%.%df", digits);
+  digits_ = digits;
+#ifdef ZLIB_FOUND
+  gzip_ = gzip;
+#endif
 
   LibertyLibrary *default_lib = network_->defaultLibertyLibrary();
   timescale_ = default_lib->units()->timeUnit()->scale();
@@ -177,7 +203,8 @@ SdfWriter::write(const char *filename,
   dcalc_ap = corner_->findDcalcAnalysisPt(min_max);
   arc_delay_max_index_ = dcalc_ap->index();
 
-  stream_ = gzopen(filename, gzip ? "wb" : "wT");
+  filename_ = filename;
+  stream_ = fopen(filename, "wb");
   if (stream_ == nullptr)
     throw FileNotWritable(filename);
 
@@ -185,9 +212,13 @@ SdfWriter::write(const char *filename,
   writeInterconnects();
   writeInstances();
   writeTrailer();
+  flushBuffer();
 
-  gzclose(stream_);
+  // Buffered write errors show up when the stream is flushed.
+  int status = fclose(stream_);
   stream_ = nullptr;
+  if (status != 0)
+    throw FileNotWritable(filename);
 }
 
 void
@@ -195,10 +226,10 @@ SdfWriter::writeHeader(LibertyLibrary *default_lib,
 		       bool no_timestamp,
 		       bool no_version)
 {
-  gzprintf(stream_, "(DELAYFILE\n");
-  gzprintf(stream_, " (SDFVERSION \"3.0\")\n");
-  gzprintf(stream_, " (DESIGN \"%s\")\n", 
-	   network_->cellName(network_->topInstance()));
+  print("(DELAYFILE\n");
+  print(" (SDFVERSION \"3.0\")\n");
+  print(" (DESIGN \"%s\")\n", 
+	network_->cellName(network_->topInstance()));
   
   if (!no_timestamp) {
     time_t now;
@@ -206,14 +237,14 @@ SdfWriter::writeHeader(LibertyLibrary *default_lib,
     char *time_str = ctime(&now);
     // Remove trailing \n.
     time_str[strlen(time_str) - 1] = '\0';
-    gzprintf(stream_, " (DATE \"%s\")\n", time_str);
+    print(" (DATE \"%s\")\n", time_str);
   }
 
-  gzprintf(stream_, " (VENDOR \"Parallax\")\n");
-  gzprintf(stream_, " (PROGRAM \"STA\")\n");
+  print(" (VENDOR \"Parallax\")\n");
+  print(" (PROGRAM \"STA\")\n");
   if (!no_version)
-    gzprintf(stream_, " (VERSION \"%s\")\n", STA_VERSION);
-  gzprintf(stream_, " (DIVIDER %c)\n", sdf_divider_);
+    print(" (VERSION \"%s\")\n", STA_VERSION);
+  print(" (DIVIDER %c)\n", sdf_divider_);
 
   LibertyLibrary *lib_min = default_lib;
   const LibertySeq &libs_min = corner_->libertyLibraries(MinMax::min());
@@ -227,15 +258,15 @@ SdfWriter::writeHeader(LibertyLibrary *default_lib,
   OperatingConditions *cond_min = lib_min->defaultOperatingConditions();
   OperatingConditions *cond_max = lib_max->defaultOperatingConditions();
   if (cond_min && cond_max) {
-    gzprintf(stream_, " (VOLTAGE %.3f::%.3f)\n",
-             cond_min->voltage(),
-             cond_max->voltage());
-    gzprintf(stream_, " (PROCESS \"%.3f::%.3f\")\n",
-             cond_min->process(),
-             cond_max->process());
-    gzprintf(stream_, " (TEMPERATURE %.3f::%.3f)\n",
-             cond_min->temperature(),
-             cond_max->temperature());
+    print(" (VOLTAGE %.3f::%.3f)\n",
+	  cond_min->voltage(),
+	  cond_max->voltage());
+    print(" (PROCESS \"%.3f::%.3f\")\n",
+	  cond_min->process(),
+	  cond_max->process());
+    print(" (TEMPERATURE %.3f::%.3f)\n",
+	  cond_min->temperature(),
+	  cond_max->temperature());
   }
 
   const char *sdf_timescale = nullptr;
@@ -258,41 +289,43 @@ SdfWriter::writeHeader(LibertyLibrary *default_lib,
   else if (fuzzyEqual(timescale_, 100e-12))
     sdf_timescale = "100ps";
   if (sdf_timescale)
-    gzprintf(stream_, " (TIMESCALE %s)\n", sdf_timescale);
+    print(" (TIMESCALE %s)\n", sdf_timescale);
 }
 
 void
 SdfWriter::writeTrailer()
 {
-  gzprintf(stream_, ")\n");
+  print(")\n");
 }
 
 void
 SdfWriter::writeInterconnects()
 {
-  gzprintf(stream_, " (CELL\n");
-  gzprintf(stream_, "  (CELLTYPE \"%s\")\n",
-	   network_->cellName(network_->topInstance()));
-  gzprintf(stream_, "  (INSTANCE)\n");
-  gzprintf(stream_, "  (DELAY\n");
-  gzprintf(stream_, "   (ABSOLUTE\n");
+  print(" (CELL\n");
+  print("  (CELLTYPE \"%s\")\n",
+	network_->cellName(network_->topInstance()));
+  print("  (INSTANCE)\n");
+  print("  (DELAY\n");
+  print("   (ABSOLUTE\n");
 
   writeInstInterconnects(network_->topInstance());
 
+  InstanceSeq insts;
   LeafInstanceIterator *inst_iter = network_->leafInstanceIterator();
   while (inst_iter->hasNext()) {
-    Instance *inst = inst_iter->next();
-    writeInstInterconnects(inst);
+    const Instance *inst = inst_iter->next();
+    insts.push_back(inst);
   }
   delete inst_iter;
+  writeInstChunks(insts, true);
 
-  gzprintf(stream_, "   )\n");
-  gzprintf(stream_, "  )\n");
-  gzprintf(stream_, " )\n");
+  print("   )\n");
+  print("  )\n");
+  print(" )\n");
 }
 
 void
-SdfWriter::writeInstInterconnects(Instance *inst)
+SdfWriter::writeInstInterconnects(const Instance *inst)
 {
   InstancePinIterator *pin_iter = network_->pinIterator(inst);
   while (pin_iter->hasNext()) {
@@ -315,11 +348,11 @@ SdfWriter::writeInterconnectFromPin(Pin *drvr_pin)
         Pin *load_pin = edge->to(graph_)->pin();
         string drvr_pin_name = sdfPathName(drvr_pin);
         string load_pin_name = sdfPathName(load_pin);
-        gzprintf(stream_, "    (INTERCONNECT %s %s ",
-                 drvr_pin_name.c_str(),
-                 load_pin_name.c_str());
+        print("    (INTERCONNECT %s %s ",
+	      drvr_pin_name.c_str(),
+	      load_pin_name.c_str());
         writeArcDelays(edge);
-        gzprintf(stream_, ")\n");
+        print(")\n");
       }
     }
   }
@@ -328,31 +361,110 @@ SdfWriter::writeInterconnectFromPin(Pin *drvr_pin)
 void
 SdfWriter::writeInstances()
 {
+  InstanceSeq insts;
   LeafInstanceIterator *leaf_iter = network_->leafInstanceIterator();
   while (leaf_iter->hasNext()) {
     const Instance *inst = leaf_iter->next();
-    bool inst_header = false;
-    writeIopaths(inst, inst_header);
-    writeTimingChecks(inst, inst_header);
-    if (inst_header)
-      writeInstTrailer();
+    insts.push_back(inst);
   }
   delete leaf_iter;
+  writeInstChunks(insts, false);
+}
+
+void
+SdfWriter::writeInstance(const Instance *inst)
+{
+  bool inst_header = false;
+  writeIopaths(inst, inst_header);
+  writeTimingChecks(inst, inst_header);
+  if (inst_header)
+    writeInstTrailer();
+}
+
+// Instances are written in fixed size chunks that are formatted (and
+// compressed) in parallel and then written in instance order. The
+// chunk boundaries do not depend on the thread count so the file is
+// the same for any thread count. Each compressed chunk is a complete
+// gzip member; concatenated members are a valid gzip file.
+static const size_t sdf_chunk_inst_count = 1024;
+
+void
+SdfWriter::writeInstChunks(const InstanceSeq &insts,
+                           bool interconnects)
+{
+  flushBuffer();
+  size_t chunk_count = (insts.size() + sdf_chunk_inst_count - 1)
+    / sdf_chunk_inst_count;
+  // Limit the number of chunks held in memory at once.
+  size_t batch_chunk_count = thread_count_ * 4;
+  Vector<string> chunks(batch_chunk_count);
+  std::atomic<bool> compress_failed(false);
+  for (size_t batch_start = 0;
+       batch_start < chunk_count;
+       batch_start += batch_chunk_count) {
+    size_t batch_end = std::min(batch_start + batch_chunk_count, chunk_count);
+    if (thread_count_ == 1) {
+      for (size_t i = batch_start; i < batch_end; i++) {
+        if (!writeInstChunk(insts, i, interconnects, chunks[i - batch_start]))
+          compress_failed = true;
+      }
+    }
+    else {
+      for (size_t i = batch_start; i < batch_end; i++) {
+        string *chunk = &chunks[i - batch_start];
+        dispatch_queue_->dispatch( [this, &insts, i, interconnects, chunk,
+                                    &compress_failed](int) {
+          if (!writeInstChunk(insts, i, interconnects, *chunk))
+            compress_failed = true;
+        });
+      }
+      dispatch_queue_->finishTasks();
+    }
+    if (compress_failed)
+      compressError();
+    for (size_t i = batch_start; i < batch_end; i++) {
+      string &chunk = chunks[i - batch_start];
+      writeChunk(chunk);
+      chunk.clear();
+    }
+  }
+}
+
+// Return true if successful.
+bool
+SdfWriter::writeInstChunk(const InstanceSeq &insts,
+                          size_t chunk_index,
+                          bool interconnects,
+                          // Return value.
+                          string &chunk)
+{
+  // Format into a private copy of the writer's buffer.
+  SdfWriter writer(*this);
+  size_t start = chunk_index * sdf_chunk_inst_count;
+  size_t end = std::min(start + sdf_chunk_inst_count, insts.size());
+  for (size_t i = start; i < end; i++) {
+    const Instance *inst = insts[i];
+    if (interconnects)
+      writer.writeInstInterconnects(inst);
+    else
+      writer.writeInstance(inst);
+  }
+  return writer.compressBuffer(chunk);
 }
 
 void
 SdfWriter::writeInstHeader(const Instance *inst)
 {
-  gzprintf(stream_, " (CELL\n");
-  gzprintf(stream_, "  (CELLTYPE \"%s\")\n", network_->cellName(inst));
+  print(" (CELL\n");
+  print("  (CELLTYPE \"%s\")\n", network_->cellName(inst));
   string inst_name = sdfPathName(inst);
-  gzprintf(stream_, "  (INSTANCE %s)\n", inst_name.c_str());
+  print("  (INSTANCE %s)\n", inst_name.c_str());
 }
 
 void
 SdfWriter::writeInstTrailer()
 {
-  gzprintf(stream_, " )\n");
+  print(" )\n");
 }
 
 void
@@ -387,18 +499,18 @@ SdfWriter::writeIopaths(const Instance *inst,
 	  }
 	  const char *sdf_cond = edge->timingArcSet()->sdfCond();
 	  if (sdf_cond) {
-	    gzprintf(stream_, "    (COND %s\n", sdf_cond);
-	    gzprintf(stream_, " ");
+	    print("    (COND %s\n", sdf_cond);
+	    print(" ");
 	  }
 	  string from_pin_name = sdfPortName(from_pin);
 	  string to_pin_name = sdfPortName(to_pin);
-          gzprintf(stream_, "    (IOPATH %s %s ",
-		   from_pin_name.c_str(),
-		   to_pin_name.c_str());
+          print("    (IOPATH %s %s ",
+		from_pin_name.c_str(),
+		to_pin_name.c_str());
 	  writeArcDelays(edge);
 	  if (sdf_cond)
-	    gzprintf(stream_, ")");
-	  gzprintf(stream_, ")\n");
+	    print(")");
+	  print(")\n");
 	}
       }
     }
@@ -412,15 +524,15 @@ SdfWriter::writeIopaths(const Instance *inst,
 void
 SdfWriter::writeIopathHeader()
 {
-  gzprintf(stream_, "  (DELAY\n");
-  gzprintf(stream_, "   (ABSOLUTE\n");
+  print("  (DELAY\n");
+  print("   (ABSOLUTE\n");
 }
 
 void
 SdfWriter::writeIopathTrailer()
 {
-  gzprintf(stream_, "   )\n");
-  gzprintf(stream_, "  )\n");
+  print("   )\n");
+  print("  )\n");
 }
 
 void
@@ -446,7 +558,7 @@ SdfWriter::writeArcDelays(Edge *edge)
 		     delays.value(RiseFall::fall(), MinMax::min()))
 	  && fuzzyEqual(delays.value(RiseFall::rise(), MinMax::max()),
 			delays.value(RiseFall::fall(),MinMax::max())))) {
-      gzprintf(stream_, " ");
+      print(" ");
       writeSdfTriple(delays, RiseFall::fall());
     }
   }
@@ -455,7 +567,7 @@ SdfWriter::writeArcDelays(Edge *edge)
     writeSdfTriple(delays, RiseFall::rise());
   else if (delays.hasValue(RiseFall::fall(), MinMax::min())) {
     // Fall only.
-    gzprintf(stream_, "() ");
+    print("() ");
     writeSdfTriple(delays, RiseFall::fall());
   }
 }
@@ -473,23 +585,122 @@ void
 SdfWriter::writeSdfTriple(float min,
                           float max)
 {
-  gzprintf(stream_, "(");
+  print("(");
   writeSdfDelay(min);
   if (include_typ_) {
-    gzprintf(stream_, ":");
+    print(":");
     writeSdfDelay((min + max) / 2.0);
-    gzprintf(stream_, ":");
+    print(":");
   }
   else
-    gzprintf(stream_, "::");
+    print("::");
   writeSdfDelay(max);
-  gzprintf(stream_, ")");
+  print(")");
 }
 
 void
 SdfWriter::writeSdfDelay(double delay)
 {
-  gzprintf(stream_, delay_format_, delay / timescale_);
+  char delay_str[64];
+  int length = snprintf(delay_str, sizeof(delay_str), "%.*f",
+                        digits_, delay / timescale_);
+  if (length >= static_cast<int>(sizeof(delay_str)))
+    print("%.*f", digits_, delay / timescale_);
+  else
+    buffer_.append(delay_str, length);
+}
+
+////////////////////////////////////////////////////////////////
+
+void
+SdfWriter::print(const char *fmt,
+                 ...)
+{
+  va_list args, args_copy;
+  va_start(args, fmt);
+  // Copy args in case the buffer needs to grow.
+  va_copy(args_copy, args);
+  char line[256];
+  int length = vsnprint(line, sizeof(line), fmt, args);
+  if (length < static_cast<int>(sizeof(line)))
+    buffer_.append(line, length);
+  else {
+    size_t buffer_length = buffer_.size();
+    buffer_.resize(buffer_length + length + 1);
+    vsnprint(&buffer_[buffer_length], length + 1, fmt, args_copy);
+    buffer_.resize(buffer_length + length);
+  }
+  va_end(args_copy);
+  va_end(args);
+}
+
+void
+SdfWriter::flushBuffer()
+{
+  string chunk;
+  if (!compressBuffer(chunk))
+    compressError();
+  writeChunk(chunk);
+}
+
+void
+SdfWriter::writeChunk(const string &chunk)
+{
+  if (!chunk.empty()
+      && fwrite(chunk.data(), 1, chunk.size(), stream_) != chunk.size()) {
+    fclose(stream_);
+    stream_ = nullptr;
+    throw FileNotWritable(filename_);
+  }
+}
+
+// Move the buffer text to chunk, compressing it as a gzip member
+// if the file is compressed.
+// Return true if successful.
+bool
+SdfWriter::compressBuffer(// Return value.
+                          string &chunk)
+{
+#ifdef ZLIB_FOUND
+  if (gzip_ && !buffer_.empty()) {
+    z_stream zstream;
+    zstream.zalloc = Z_NULL;
+    zstream.zfree = Z_NULL;
+    zstream.opaque = Z_NULL;
+    // 16 selects the gzip header/trailer.
+    if (deflateInit2(&zstream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8,
+                     Z_DEFAULT_STRATEGY) != Z_OK) {
+      chunk.clear();
+      return false;
+    }
+    chunk.resize(deflateBound(&zstream, buffer_.size()));
+    zstream.next_in = reinterpret_cast<Bytef*>(&buffer_[0]);
+    zstream.avail_in = buffer_.size();
+    zstream.next_out = reinterpret_cast<Bytef*>(&chunk[0]);
+    zstream.avail_out = chunk.size();
+    // The output is sized by deflateBound so one pass finishes.
+    bool finished = deflate(&zstream, Z_FINISH) == Z_STREAM_END;
+    chunk.resize(zstream.total_out);
+    bool ended = deflateEnd(&zstream) == Z_OK;
+    buffer_.clear();
+    if (!(finished && ended)) {
+      chunk.clear();
+      return false;
+    }
+    return true;
+  }
+#endif
+  chunk.swap(buffer_);
+  buffer_.clear();
+  return true;
+}
+
+void
+SdfWriter::compressError()
+{
+  fclose(stream_);
+  stream_ = nullptr;
+  report_->error(624, "compressing SDF file %s failed.", filename_);
 }
 
 void
@@ -564,13 +775,13 @@ SdfWriter::ensureTimingCheckheaders(bool &check_header,
 void
 SdfWriter::writeTimingCheckHeader()
 {
-  gzprintf(stream_, "  (TIMINGCHECK\n");
+  print("  (TIMINGCHECK\n");
 }
 
 void
 SdfWriter::writeTimingCheckTrailer()
 {
-  gzprintf(stream_, "  )\n");
+  print("  )\n");
 }
 
 void
@@ -652,46 +863,46 @@ SdfWriter::writeCheck(Edge *edge,
   const char *sdf_cond_start = arc_set->sdfCondStart();
   const char *sdf_cond_end = arc_set->sdfCondEnd();
 
-  gzprintf(stream_, "    (%s ", sdf_check);
+  print("    (%s ", sdf_check);
 
   if (sdf_cond_start)
-    gzprintf(stream_, "(COND %s ", sdf_cond_start);
+    print("(COND %s ", sdf_cond_start);
 
   string to_pin_name = sdfPortName(to_pin);
   if (use_data_edge) {
-    gzprintf(stream_, "(%s %s)",
-	     sdfEdge(arc->toEdge()),
-	     to_pin_name.c_str());
+    print("(%s %s)",
+	  sdfEdge(arc->toEdge()),
+	  to_pin_name.c_str());
   }
   else
-    gzprintf(stream_, "%s", to_pin_name.c_str());
+    print("%s", to_pin_name.c_str());
 
   if (sdf_cond_start)
-    gzprintf(stream_, ")");
+    print(")");
 
-  gzprintf(stream_, " ");
+  print(" ");
 
   if (sdf_cond_end)
-    gzprintf(stream_, "(COND %s ", sdf_cond_end);
+    print("(COND %s ", sdf_cond_end);
 
   string from_pin_name = sdfPortName(from_pin);
   if (use_clk_edge)
-    gzprintf(stream_, "(%s %s)",
-	     sdfEdge(arc->fromEdge()),
-	     from_pin_name.c_str());
+    print("(%s %s)",
+	  sdfEdge(arc->fromEdge()),
+	  from_pin_name.c_str());
   else
-    gzprintf(stream_, "%s", from_pin_name.c_str());
+    print("%s", from_pin_name.c_str());
 
   if (sdf_cond_end)
-    gzprintf(stream_, ")");
+    print(")");
 
-  gzprintf(stream_, " ");
+  print(" ");
 
   ArcDelay min_delay = graph_->arcDelay(edge, arc, arc_delay_min_index_);
   ArcDelay max_delay = graph_->arcDelay(edge, arc, arc_delay_max_index_);
   writeSdfTriple(delayAsFloat(min_delay), delayAsFloat(max_delay));
 
-  gzprintf(stream_, ")\n");
+  print(")\n");
 }
 
 void
@@ -701,11 +912,11 @@ SdfWriter::writeWidthCheck(const Pin *pin,
 			   float max_width)
 {
   string pin_name = sdfPortName(pin);
-  gzprintf(stream_, "    (WIDTH (%s %s) ",
-	   sdfEdge(hi_low->asTransition()),
-	   pin_name.c_str());
+  print("    (WIDTH (%s %s) ",
+	sdfEdge(hi_low->asTransition()),
+	pin_name.c_str());
   writeSdfTriple(min_width, max_width);
-  gzprintf(stream_, ")\n");
+  print(")\n");
 }
 
 void
@@ -713,9 +924,9 @@ SdfWriter::writePeriodCheck(const Pin *pin,
 			    float min_period)
 {
   string pin_name = sdfPortName(pin);
-  gzprintf(stream_, "    (PERIOD %s ", pin_name.c_str());
+  print("    (PERIOD %s ", pin_name.c_str());
   writeSdfTriple(min_period, min_period);
-  gzprintf(stream_, ")\n");
+  print(")\n");
 }
 
 const char *
@@ -18,6 +18,7 @@
 
 #include "Report.hh"
 #include "Debug.hh"
+#include "Stats.hh"
 #include "Mutex.hh"
 #include "DispatchQueue.hh"
 #include "Network.hh"
@@ -151,6 +152,7 @@ BfsIterator::visit(Level to_level,
       if (vertex) {
         vertex->setBfsInQueue(bfs_index_, false);
         visitor->visit(vertex);
+        Stats::incrCount(StatsCount::vertex_visits);
         visit_count++;
       }
     }
@@ -184,6 +186,7 @@ BfsIterator::visitParallel(Level to_level,
               if (vertex) {
                 vertex->setBfsInQueue(bfs_index_, false);
                 visitor->visit(vertex);
+                Stats::incrCount(StatsCount::vertex_visits);
               }
             }
           }
@@ -199,6 +202,7 @@ BfsIterator::visitParallel(Level to_level,
                   if (vertex) {
                     vertex->setBfsInQueue(bfs_index_, false);
                     visitors[k]->visit(vertex);
+                    Stats::incrCount(StatsCount::vertex_visits);
                   }
                 }
               });
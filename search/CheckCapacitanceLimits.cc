@@ -16,6 +16,8 @@
 
 #include "CheckCapacitanceLimits.hh"
 
+#include <algorithm>
+
 #include "Fuzzy.hh"
 #include "Liberty.hh"
 #include "Network.hh"
@@ -32,53 +34,35 @@
 
 namespace sta {
 
+// Compare the slacks found when the pins were checked so the sort does
+// not have to find the limits and load capacitances again.
 class PinCapacitanceLimitSlackLess
 {
 public:
-  PinCapacitanceLimitSlackLess(const Corner *corner,
-			       const MinMax *min_max,
-			       CheckCapacitanceLimits *check_capacitance_limit,
-			       const StaState *sta);
-  bool operator()(const Pin *pin1,
-		  const Pin *pin2) const;
+  PinCapacitanceLimitSlackLess(const StaState *sta);
+  bool operator()(const PinSlack &pin_slack1,
+		  const PinSlack &pin_slack2) const;
 
 private:
-  const Corner *corner_;
-  const MinMax *min_max_;
-  CheckCapacitanceLimits *check_capacitance_limit_;
   const StaState *sta_;
 
 };
 
-PinCapacitanceLimitSlackLess::PinCapacitanceLimitSlackLess(const Corner *corner,
-							   const MinMax *min_max,
-							   CheckCapacitanceLimits *check_capacitance_limit,
-							   const StaState *sta) :
-  corner_(corner),
-  min_max_(min_max),
-  check_capacitance_limit_(check_capacitance_limit),
+PinCapacitanceLimitSlackLess::PinCapacitanceLimitSlackLess(const StaState *sta) :
   sta_(sta)
 {
 }
 
 bool
-PinCapacitanceLimitSlackLess::operator()(const Pin *pin1,
-					 const Pin *pin2) const
+PinCapacitanceLimitSlackLess::operator()(const PinSlack &pin_slack1,
+					 const PinSlack &pin_slack2) const
 {
-  const Corner *corner1, *corner2;
-  const RiseFall *rf1, *rf2;
-  float capacitance1, capacitance2;
-  float limit1, limit2, slack1, slack2;
-  check_capacitance_limit_->checkCapacitance(pin1, corner_, min_max_,
-					     corner1, rf1, capacitance1,
-					     limit1, slack1);
-  check_capacitance_limit_->checkCapacitance(pin2, corner_, min_max_,
-					     corner2, rf2, capacitance2,
-					     limit2, slack2);
+  float slack1 = pin_slack1.second;
+  float slack2 = pin_slack2.second;
   return fuzzyLess(slack1, slack2)
     || (fuzzyEqual(slack1, slack2)
 	// Break ties for the sake of regression stability.
-	&& sta_->network()->pinLess(pin1, pin2));
+	&& sta_->network()->pinLess(pin_slack1.first, pin_slack2.first));
 }
 
 ////////////////////////////////////////////////////////////////
@@ -257,7 +241,7 @@ CheckCapacitanceLimits::checkCapacitanceLimits(const Net *net,
                                                const MinMax *min_max)
 {
   const Network *network = sta_->network();
-  PinSeq cap_pins;
+  PinSlackSeq cap_pins;
   float min_slack = MinMax::min()->initValue();
   if (net) {
     NetPinIterator *pin_iter = network->pinIterator(net);
@@ -268,6 +252,8 @@ CheckCapacitanceLimits::checkCapacitanceLimits(const Net *net,
     delete pin_iter;
   }
   else {
+    // The load capacitance is found with the shared arc delay calculator,
+    // so the pins are checked serially.
     LeafInstanceIterator *inst_iter = network->leafInstanceIterator();
     while (inst_iter->hasNext()) {
       Instance *inst = inst_iter->next();
@@ -278,11 +264,14 @@ CheckCapacitanceLimits::checkCapacitanceLimits(const Net *net,
     checkCapLimits(network->topInstance(), violators, corner, min_max,
                    cap_pins, min_slack);
   }
-  sort(cap_pins, PinCapacitanceLimitSlackLess(corner, min_max, this, sta_));
+  sort(cap_pins, PinCapacitanceLimitSlackLess(sta_));
   // Keep the min slack pin unless all violators or net pins.
   if (!cap_pins.empty() && !violators && net == nullptr)
     cap_pins.resize(1);
-  return cap_pins;
+  PinSeq pins;
+  for (const PinSlack &pin_slack : cap_pins)
+    pins.push_back(pin_slack.first);
+  return pins;
 }
 
 void
@@ -290,7 +279,7 @@ CheckCapacitanceLimits::checkCapLimits(const Instance *inst,
                                        bool violators,
                                        const Corner *corner,
                                        const MinMax *min_max,
-                                       PinSeq &cap_pins,
+                                       PinSlackSeq &cap_pins,
                                        float &min_slack)
 {
   const Network *network = sta_->network();
@@ -307,7 +296,7 @@ CheckCapacitanceLimits::checkCapLimits(const Pin *pin,
                                        bool violators,
                                        const Corner *corner,
                                        const MinMax *min_max,
-                                       PinSeq &cap_pins,
+                                       PinSlackSeq &cap_pins,
                                        float &min_slack)
 {
   if (checkPin(pin)) {
@@ -318,13 +307,16 @@ CheckCapacitanceLimits::checkCapLimits(const Pin *pin,
     if (!fuzzyInf(slack)) {
       if (violators) {
         if (slack < 0.0)
-          cap_pins.push_back(pin);
+          cap_pins.push_back(PinSlack(pin, slack));
       }
       else {
+        // Keep pins that tie the min slack so the sort picks the same
+        // pin no matter which thread checked it first.
         if (cap_pins.empty()
-            || slack < min_slack) {
-          cap_pins.push_back(pin);
-          min_slack = slack;
+            || slack < min_slack
+            || fuzzyEqual(slack, min_slack)) {
+          cap_pins.push_back(PinSlack(pin, slack));
+          min_slack = std::min(min_slack, slack);
         }
       }
     }
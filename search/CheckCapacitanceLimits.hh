@@ -81,13 +81,13 @@ protected:
                       bool violators,
                       const Corner *corner,
                       const MinMax *min_max,
-                      PinSeq &cap_pins,
+                      PinSlackSeq &cap_pins,
                       float &min_slack);
   void checkCapLimits(const Pin *pin,
                       bool violators,
                       const Corner *corner,
                       const MinMax *min_max,
-                      PinSeq &cap_pins,
+                      PinSlackSeq &cap_pins,
                       float &min_slack);
   bool checkPin(const Pin *pin);
 
@@ -16,7 +16,10 @@
 
 #include "CheckFanoutLimits.hh"
 
+#include <algorithm>
+
 #include "Fuzzy.hh"
+#include "DispatchQueue.hh"
 #include "Liberty.hh"
 #include "Network.hh"
 #include "Sdc.hh"
@@ -28,45 +31,35 @@
 
 namespace sta {
 
+// Compare the slacks found when the pins were checked so the sort does
+// not have to find the limits and fanouts again.
 class PinFanoutLimitSlackLess
 {
 public:
-  PinFanoutLimitSlackLess(const MinMax *min_max,
-			  CheckFanoutLimits *check_fanout_limit,
-			  const StaState *sta);
-  bool operator()(const Pin *pin1,
-		  const Pin *pin2) const;
+  PinFanoutLimitSlackLess(const StaState *sta);
+  bool operator()(const PinSlack &pin_slack1,
+		  const PinSlack &pin_slack2) const;
 
 private:
-  const MinMax *min_max_;
-  CheckFanoutLimits *check_fanout_limit_;
   const StaState *sta_;
 
 };
 
-PinFanoutLimitSlackLess::PinFanoutLimitSlackLess(const MinMax *min_max,
-						 CheckFanoutLimits *check_fanout_limit,
-						 const StaState *sta) :
-  min_max_(min_max),
-  check_fanout_limit_(check_fanout_limit),
+PinFanoutLimitSlackLess::PinFanoutLimitSlackLess(const StaState *sta) :
   sta_(sta)
 {
 }
 
 bool
-PinFanoutLimitSlackLess::operator()(const Pin *pin1,
-				    const Pin *pin2) const
+PinFanoutLimitSlackLess::operator()(const PinSlack &pin_slack1,
+				    const PinSlack &pin_slack2) const
 {
-  float fanout1, fanout2;
-  float limit1, limit2, slack1, slack2;
-  check_fanout_limit_->checkFanout(pin1, min_max_,
-				   fanout1, limit1, slack1);
-  check_fanout_limit_->checkFanout(pin2, min_max_,
-				   fanout2, limit2, slack2);
+  float slack1 = pin_slack1.second;
+  float slack2 = pin_slack2.second;
   return fuzzyLess(slack1, slack2)
     || (fuzzyEqual(slack1, slack2)
 	// Break ties for the sake of regression stability.
-	&& sta_->network()->pinLess(pin1, pin2));
+	&& sta_->network()->pinLess(pin_slack1.first, pin_slack2.first));
 }
 
 ////////////////////////////////////////////////////////////////
@@ -236,7 +229,7 @@ CheckFanoutLimits::checkFanoutLimits(const Net *net,
                                      const MinMax *min_max)
 {
   const Network *network = sta_->network();
-  PinSeq fanout_pins;
+  PinSlackSeq fanout_pins;
   float min_slack = MinMax::min()->initValue();
   if (net) {
     NetPinIterator *pin_iter = network->pinIterator(net);
@@ -247,28 +240,75 @@ CheckFanoutLimits::checkFanoutLimits(const Net *net,
     delete pin_iter;
   }
   else {
+    InstanceSeq insts;
     LeafInstanceIterator *inst_iter = network->leafInstanceIterator();
     while (inst_iter->hasNext()) {
       const Instance *inst = inst_iter->next();
-      checkFanoutLimits(inst, violators, min_max, fanout_pins, min_slack);
+      insts.push_back(inst);
     }
     delete inst_iter;
     // Check top level ports.
-    checkFanoutLimits(network->topInstance(), violators, min_max,
-                    fanout_pins, min_slack);
+    insts.push_back(network->topInstance());
+    checkFanoutLimits(insts, violators, min_max, fanout_pins, min_slack);
   }
-  sort(fanout_pins, PinFanoutLimitSlackLess(min_max, this, sta_));
+  sort(fanout_pins, PinFanoutLimitSlackLess(sta_));
   // Keep the min slack pin unless all violators or net pins.
   if (!fanout_pins.empty() && !violators && net == nullptr)
     fanout_pins.resize(1);
-  return fanout_pins;
+  PinSeq pins;
+  for (const PinSlack &pin_slack : fanout_pins)
+    pins.push_back(pin_slack.first);
+  return pins;
+}
+
+// Instances are checked in parallel with a pin buffer per thread.
+// Each thread gets several chunks of instances so the tasks are large
+// enough to hide the dispatch queue overhead and still balance.
+static const size_t check_chunks_per_thread = 8;
+
+void
+CheckFanoutLimits::checkFanoutLimits(const InstanceSeq &insts,
+                                     bool violators,
+                                     const MinMax *min_max,
+                                     PinSlackSeq &fanout_pins,
+                                     float &min_slack)
+{
+  int thread_count = sta_->threadCount();
+  if (thread_count == 1) {
+    for (const Instance *inst : insts)
+      checkFanoutLimits(inst, violators, min_max, fanout_pins, min_slack);
+  }
+  else {
+    Vector<PinSlackSeq> thread_pins(thread_count);
+    Vector<float> thread_min_slacks(thread_count, min_slack);
+    DispatchQueue *dispatch_queue = sta_->dispatchQueue();
+    size_t inst_count = insts.size();
+    size_t chunk_size = std::max(inst_count / (thread_count
+                                               * check_chunks_per_thread),
+                                 size_t(1));
+    for (size_t begin = 0; begin < inst_count; begin += chunk_size) {
+      size_t end = std::min(begin + chunk_size, inst_count);
+      dispatch_queue->dispatch( [this, &insts, begin, end, violators, min_max,
+                                 &thread_pins, &thread_min_slacks](int i) {
+        for (size_t j = begin; j < end; j++)
+          checkFanoutLimits(insts[j], violators, min_max,
+                            thread_pins[i], thread_min_slacks[i]);
+      });
+    }
+    dispatch_queue->finishTasks();
+    for (int i = 0; i < thread_count; i++) {
+      PinSlackSeq &pins = thread_pins[i];
+      fanout_pins.insert(fanout_pins.end(), pins.begin(), pins.end());
+      min_slack = std::min(min_slack, thread_min_slacks[i]);
+    }
+  }
 }
 
 void
 CheckFanoutLimits::checkFanoutLimits(const Instance *inst,
                                      bool violators,
                                      const MinMax *min_max,
-                                     PinSeq &fanout_pins,
+                                     PinSlackSeq &fanout_pins,
                                      float &min_slack)
 {
   const Network *network = sta_->network();
@@ -284,7 +324,7 @@ void
 CheckFanoutLimits::checkFanoutLimits(const Pin *pin,
                                      bool violators,
                                      const MinMax *min_max,
-                                     PinSeq &fanout_pins,
+                                     PinSlackSeq &fanout_pins,
                                      float &min_slack)
 {
   if (checkPin(pin)) {
@@ -294,13 +334,16 @@ CheckFanoutLimits::checkFanoutLimits(const Pin *pin,
     if (!fuzzyInf(slack)) {
       if (violators) {
         if (slack < 0.0)
-          fanout_pins.push_back(pin);
+          fanout_pins.push_back(PinSlack(pin, slack));
       }
       else {
+        // Keep pins that tie the min slack so the sort picks the same
+        // pin no matter which thread checked it first.
         if (fanout_pins.empty()
-            || slack < min_slack) {
-          fanout_pins.push_back(pin);
-          min_slack = slack;
+            || slack < min_slack
+            || fuzzyEqual(slack, min_slack)) {
+          fanout_pins.push_back(PinSlack(pin, slack));
+          min_slack = std::min(min_slack, slack);
         }
       }
     }
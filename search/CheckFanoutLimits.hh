@@ -56,15 +56,20 @@ protected:
 		 float &limit,
 		 bool &limit_exists) const;
   float fanoutLoad(const Pin *pin) const;
+  void checkFanoutLimits(const InstanceSeq &insts,
+                         bool violators,
+                         const MinMax *min_max,
+                         PinSlackSeq &fanout_pins,
+                         float &min_slack);
   void checkFanoutLimits(const Instance *inst,
                          bool violators,
                          const MinMax *min_max,
-                         PinSeq &fanout_pins,
+                         PinSlackSeq &fanout_pins,
                          float &min_slack);
   void checkFanoutLimits(const Pin *pin,
                          bool violators,
                          const MinMax *min_max,
-                         PinSeq &fanout_pins,
+                         PinSlackSeq &fanout_pins,
                          float &min_slack);
   bool checkPin(const Pin *pin);
 
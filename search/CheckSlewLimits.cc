@@ -16,7 +16,10 @@
 
 #include "CheckSlewLimits.hh"
 
+#include <algorithm>
+
 #include "Fuzzy.hh"
+#include "DispatchQueue.hh"
 #include "Liberty.hh"
 #include "Network.hh"
 #include "Sdc.hh"
@@ -33,51 +36,35 @@
 
 namespace sta {
 
+// Compare the slacks found when the pins were checked so the sort does
+// not have to find the limits and slews again.
 class PinSlewLimitSlackLess
 {
 public:
-  PinSlewLimitSlackLess(const Corner *corner,
-			const MinMax *min_max,
-			CheckSlewLimits *check_slew_limit,
-			const StaState *sta);
-  bool operator()(const Pin *pin1,
-		  const Pin *pin2) const;
+  PinSlewLimitSlackLess(const StaState *sta);
+  bool operator()(const PinSlack &pin_slack1,
+		  const PinSlack &pin_slack2) const;
 
 private:
-  const Corner *corner_;
-  const MinMax *min_max_;
-  CheckSlewLimits *check_slew_limit_;
   const StaState *sta_;
 
 };
 
-PinSlewLimitSlackLess::PinSlewLimitSlackLess(const Corner *corner,
-					     const MinMax *min_max,
-					     CheckSlewLimits *check_slew_limit,
-					     const StaState *sta) :
-  corner_(corner),
-  min_max_(min_max),
-  check_slew_limit_(check_slew_limit),
+PinSlewLimitSlackLess::PinSlewLimitSlackLess(const StaState *sta) :
   sta_(sta)
 {
 }
 
 bool
-PinSlewLimitSlackLess::operator()(const Pin *pin1,
-				  const Pin *pin2) const
+PinSlewLimitSlackLess::operator()(const PinSlack &pin_slack1,
+				  const PinSlack &pin_slack2) const
 {
-  const Corner *corner1, *corner2;
-  const RiseFall *rf1, *rf2;
-  Slew slew1, slew2;
-  float limit1, limit2, slack1, slack2;
-  check_slew_limit_->checkSlew(pin1, corner_, min_max_, true,
-			       corner1, rf1, slew1, limit1, slack1);
-  check_slew_limit_->checkSlew(pin2, corner_, min_max_, true,
-			       corner2, rf2, slew2, limit2, slack2);
+  float slack1 = pin_slack1.second;
+  float slack2 = pin_slack2.second;
   return fuzzyLess(slack1, slack2)
     || (fuzzyEqual(slack1, slack2)
 	// Break ties for the sake of regression stability.
-	&& sta_->network()->pinLess(pin1, pin2));
+	&& sta_->network()->pinLess(pin_slack1.first, pin_slack2.first));
 }
 
 ////////////////////////////////////////////////////////////////
@@ -338,7 +325,7 @@ CheckSlewLimits::checkSlewLimits(const Net *net,
                                  const MinMax *min_max)
 {
   const Network *network = sta_->network();
-  PinSeq slew_pins;
+  PinSlackSeq slew_pins;
   float min_slack = MinMax::min()->initValue();
   if (net) {
     NetPinIterator *pin_iter = network->pinIterator(net);
@@ -349,21 +336,70 @@ CheckSlewLimits::checkSlewLimits(const Net *net,
     delete pin_iter;
   }
   else {
+    InstanceSeq insts;
     LeafInstanceIterator *inst_iter = network->leafInstanceIterator();
     while (inst_iter->hasNext()) {
       const Instance *inst = inst_iter->next();
-      checkSlewLimits(inst, violators,corner, min_max, slew_pins, min_slack);
+      insts.push_back(inst);
     }
     delete inst_iter;
     // Check top level ports.
-    checkSlewLimits(network->topInstance(), violators, corner, min_max,
-                    slew_pins, min_slack);
+    insts.push_back(network->topInstance());
+    checkSlewLimits(insts, violators, corner, min_max, slew_pins, min_slack);
   }
-  sort(slew_pins, PinSlewLimitSlackLess(corner, min_max, this, sta_));
+  sort(slew_pins, PinSlewLimitSlackLess(sta_));
   // Keep the min slack pin unless all violators or net pins.
   if (!slew_pins.empty() && !violators && net == nullptr)
     slew_pins.resize(1);
-  return slew_pins;
+  PinSeq pins;
+  for (const PinSlack &pin_slack : slew_pins)
+    pins.push_back(pin_slack.first);
+  return pins;
+}
+
+// Instances are checked in parallel with a pin buffer per thread.
+// Each thread gets several chunks of instances so the tasks are large
+// enough to hide the dispatch queue overhead and still balance.
+static const size_t check_chunks_per_thread = 8;
+
+void
+CheckSlewLimits::checkSlewLimits(const InstanceSeq &insts,
+                                 bool violators,
+                                 const Corner *corner,
+                                 const MinMax *min_max,
+                                 PinSlackSeq &slew_pins,
+                                 float &min_slack)
+{
+  int thread_count = sta_->threadCount();
+  if (thread_count == 1) {
+    for (const Instance *inst : insts)
+      checkSlewLimits(inst, violators, corner, min_max, slew_pins, min_slack);
+  }
+  else {
+    Vector<PinSlackSeq> thread_pins(thread_count);
+    Vector<float> thread_min_slacks(thread_count, min_slack);
+    DispatchQueue *dispatch_queue = sta_->dispatchQueue();
+    size_t inst_count = insts.size();
+    size_t chunk_size = std::max(inst_count / (thread_count
+                                               * check_chunks_per_thread),
+                                 size_t(1));
+    for (size_t begin = 0; begin < inst_count; begin += chunk_size) {
+      size_t end = std::min(begin + chunk_size, inst_count);
+      dispatch_queue->dispatch( [this, &insts, begin, end, violators,
+                                 corner, min_max,
+                                 &thread_pins, &thread_min_slacks](int i) {
+        for (size_t j = begin; j < end; j++)
+          checkSlewLimits(insts[j], violators, corner, min_max,
+                          thread_pins[i], thread_min_slacks[i]);
+      });
+    }
+    dispatch_queue->finishTasks();
+    for (int i = 0; i < thread_count; i++) {
+      PinSlackSeq &pins = thread_pins[i];
+      slew_pins.insert(slew_pins.end(), pins.begin(), pins.end());
+      min_slack = std::min(min_slack, thread_min_slacks[i]);
+    }
+  }
 }
 
 void
@@ -371,7 +407,7 @@ CheckSlewLimits::checkSlewLimits(const Instance *inst,
                                  bool violators,
                                  const Corner *corner,
                                  const MinMax *min_max,
-                                 PinSeq &slew_pins,
+                                 PinSlackSeq &slew_pins,
                                  float &min_slack)
 {
   const Network *network = sta_->network();
@@ -388,7 +424,7 @@ CheckSlewLimits::checkSlewLimits(const Pin *pin,
                                  bool violators,
                                  const Corner *corner,
                                  const MinMax *min_max,
-                                 PinSeq &slew_pins,
+                                 PinSlackSeq &slew_pins,
                                  float &min_slack)
 {
   const Corner *corner1;
@@ -399,13 +435,16 @@ CheckSlewLimits::checkSlewLimits(const Pin *pin,
   if (!fuzzyInf(slack)) {
     if (violators) {
       if (slack < 0.0)
-        slew_pins.push_back(pin);
+        slew_pins.push_back(PinSlack(pin, slack));
     }
     else {
+      // Keep pins that tie the min slack so the sort picks the same
+      // pin no matter which thread checked it first.
       if (slew_pins.empty()
-          || slack < min_slack) {
-        slew_pins.push_back(pin);
-        min_slack = slack;
+          || slack < min_slack
+          || fuzzyEqual(slack, min_slack)) {
+        slew_pins.push_back(PinSlack(pin, slack));
+        min_slack = std::min(min_slack, slack);
       }
     }
   }
@@ -22,6 +22,7 @@
 #include "GraphClass.hh"
 #include "Delay.hh"
 #include "SdcClass.hh"
+#include "SearchClass.hh"
 
 namespace sta {
 
@@ -100,17 +101,23 @@ protected:
 		 // Return values.
 		 float &limit,
 		 bool &limit_exists) const;
+  void checkSlewLimits(const InstanceSeq &insts,
+                       bool violators,
+                       const Corner *corner,
+                       const MinMax *min_max,
+                       PinSlackSeq &slew_pins,
+                       float &min_slack);
   void checkSlewLimits(const Instance *inst,
                        bool violators,
                        const Corner *corner,
                        const MinMax *min_max,
-                       PinSeq &slew_pins,
+                       PinSlackSeq &slew_pins,
                        float &min_slack);
   void checkSlewLimits(const Pin *pin,
                        bool violators,
                        const Corner *corner,
                        const MinMax *min_max,
-                       PinSeq &slew_pins,
+                       PinSlackSeq &slew_pins,
                        float &min_slack);
   void clockDomains(const Vertex *vertex,
 		    // Return value.
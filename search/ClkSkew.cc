@@ -21,13 +21,14 @@
 
 #include "Report.hh"
 #include "Debug.hh"
+#include "DispatchQueue.hh"
+#include "Vector.hh"
 #include "Units.hh"
 #include "TimingArc.hh"
 #include "Liberty.hh"
 #include "Network.hh"
 #include "Graph.hh"
 #include "Sdc.hh"
-#include "Bfs.hh"
 #include "PathVertex.hh"
 #include "StaState.hh"
 #include "PathAnalysisPt.hh"
@@ -240,32 +241,83 @@ ClkSkews::findClkSkew(ConstClockSeq &clks,
 		      const Corner *corner,
 		      const SetupHold *setup_hold)
 {	      
-  ClkSkewMap skews;
-
   ConstClockSet clk_set;
   for (const Clock *clk : clks)
     clk_set.insert(clk);
 
-  for (Vertex *src_vertex : *graph_->regClkVertices()) {
-    if (hasClkPaths(src_vertex, clk_set)) {
-      VertexOutEdgeIterator edge_iter(src_vertex, graph_);
-      while (edge_iter.hasNext()) {
-	Edge *edge = edge_iter.next();
-	if (edge->role()->genericRole() == TimingRole::regClkToQ()) {
-	  Vertex *q_vertex = edge->to(graph_);
-	  const RiseFall *rf = edge->timingArcSet()->isRisingFallingEdge();
-	  const RiseFallBoth *src_rf = rf
-	    ? rf->asRiseFallBoth()
-	    : RiseFallBoth::riseFall();
-	  findClkSkewFrom(src_vertex, q_vertex, src_rf, clk_set,
-			  corner, setup_hold, skews);
-	}
-      }
+  // Each source register is independent, so search them in parallel
+  // with a skew map per thread and merge the results.
+  VertexSet *src_vertices = graph_->regClkVertices();
+  Vector<ClkSkewMap> thread_skews(thread_count_);
+  if (thread_count_ == 1) {
+    for (Vertex *src_vertex : *src_vertices)
+      findClkSkewFrom(src_vertex, clk_set, corner, setup_hold,
+                      thread_skews[0]);
+  }
+  else {
+    for (Vertex *src_vertex : *src_vertices) {
+      dispatch_queue_->dispatch( [this, src_vertex, &clk_set, corner,
+                                  setup_hold, &thread_skews](int i) {
+        findClkSkewFrom(src_vertex, clk_set, corner, setup_hold,
+                        thread_skews[i]);
+      });
+    }
+    dispatch_queue_->finishTasks();
+  }
+
+  ClkSkewMap skews;
+  for (ClkSkewMap &skews1 : thread_skews) {
+    for (auto &clk_skew_itr : skews1) {
+      const Clock *clk = clk_skew_itr.first;
+      ClkSkew &skew1 = clk_skew_itr.second;
+      ClkSkew &clk_skew = skews[clk];
+      if (clk_skew.srcPath()->isNull()
+          || clkSkewWorse(skew1, clk_skew))
+        clk_skew = skew1;
     }
   }
   return skews;
 }
 
+void
+ClkSkews::findClkSkewFrom(Vertex *src_vertex,
+                          ConstClockSet &clk_set,
+			  const Corner *corner,
+			  const SetupHold *setup_hold,
+			  ClkSkewMap &skews)
+{
+  if (hasClkPaths(src_vertex, clk_set)) {
+    VertexOutEdgeIterator edge_iter(src_vertex, graph_);
+    while (edge_iter.hasNext()) {
+      Edge *edge = edge_iter.next();
+      if (edge->role()->genericRole() == TimingRole::regClkToQ()) {
+        Vertex *q_vertex = edge->to(graph_);
+        const RiseFall *rf = edge->timingArcSet()->isRisingFallingEdge();
+        const RiseFallBoth *src_rf = rf
+          ? rf->asRiseFallBoth()
+          : RiseFallBoth::riseFall();
+        findClkSkewFrom(src_vertex, q_vertex, src_rf, clk_set,
+                        corner, setup_hold, skews);
+      }
+    }
+  }
+}
+
+// Larger absolute skew is worse. Break ties with the source vertex id
+// so the result does not depend on how the source registers were
+// divided between threads.
+bool
+ClkSkews::clkSkewWorse(ClkSkew &skew1,
+                       ClkSkew &skew2)
+{
+  float abs_skew1 = abs(skew1.skew());
+  float abs_skew2 = abs(skew2.skew());
+  return abs_skew1 > abs_skew2
+    || (abs_skew1 == abs_skew2
+        && graph_->id(skew1.srcPath()->vertex(this))
+        < graph_->id(skew2.srcPath()->vertex(this)));
+}
+
 bool
 ClkSkews::hasClkPaths(Vertex *vertex,
 		      ConstClockSet &clks)
@@ -356,7 +408,7 @@ ClkSkews::findClkSkew(Vertex *src_vertex,
                        delayAsString(probe.crpr(this), this),
                        time_unit->asString(probe.skew()));
 	    if (clk_skew.srcPath()->isNull()
-                || abs(probe.skew()) > abs(clk_skew.skew()))
+                || clkSkewWorse(probe, clk_skew))
 	      clk_skew = probe;
 	  }
 	}
@@ -388,23 +440,42 @@ FanOutSrchPred::searchThru(Edge *edge)
         || role == TimingRole::tristateDisable());
 }
 
+// Use a private work list instead of a BfsFwdIterator so the search
+// does not touch the shared vertex bfs queue flags and can run in
+// multiple threads.
 VertexSet
 ClkSkews::findFanout(Vertex *from)
 {
   debugPrint(debug_, "fanout", 1, "%s",
              from->name(sdc_network_));
   VertexSet endpoints(graph_);
+  VertexSet visited(graph_);
   FanOutSrchPred pred(this);
-  BfsFwdIterator fanout_iter(BfsIndex::other, &pred, this);
-  fanout_iter.enqueue(from);
-  while (fanout_iter.hasNext()) {
-    Vertex *fanout = fanout_iter.next();
+  VertexSeq queue;
+  queue.push_back(from);
+  visited.insert(from);
+  while (!queue.empty()) {
+    Vertex *fanout = queue.back();
+    queue.pop_back();
     if (fanout->hasChecks()) {
       debugPrint(debug_, "fanout", 1, " endpoint %s",
                  fanout->name(sdc_network_));
       endpoints.insert(fanout);
     }
-    fanout_iter.enqueueAdjacentVertices(fanout);
+    // Same edge filtering as BfsFwdIterator::enqueueAdjacentVertices.
+    if (pred.searchFrom(fanout)) {
+      VertexOutEdgeIterator edge_iter(fanout, graph_);
+      while (edge_iter.hasNext()) {
+        Edge *edge = edge_iter.next();
+        Vertex *to_vertex = edge->to(graph_);
+        if (!visited.hasKey(to_vertex)
+            && pred.searchThru(edge)
+            && pred.searchTo(to_vertex)) {
+          visited.insert(to_vertex);
+          queue.push_back(to_vertex);
+        }
+      }
+    }
   }
   return endpoints;
 }
@@ -50,6 +50,11 @@ protected:
                          const SetupHold *setup_hold);
   bool hasClkPaths(Vertex *vertex,
 		   ConstClockSet &clks);
+  void findClkSkewFrom(Vertex *src_vertex,
+		       ConstClockSet &clk_set,
+		       const Corner *corner,
+		       const SetupHold *setup_hold,
+		       ClkSkewMap &skews);
   void findClkSkewFrom(Vertex *src_vertex,
 		       Vertex *q_vertex,
 		       const RiseFallBoth *src_rf,
@@ -65,6 +70,8 @@ protected:
 		   const Corner *corner,
 		   const SetupHold *setup_hold,
 		   ClkSkewMap &skews);
+  bool clkSkewWorse(ClkSkew &skew1,
+                    ClkSkew &skew2);
   VertexSet findFanout(Vertex *from);
   void reportClkSkew(ClkSkew &clk_skew,
                      int digits);
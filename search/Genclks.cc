@@ -18,6 +18,7 @@
 
 #include "Stats.hh"
 #include "Debug.hh"
+#include "DispatchQueue.hh"
 #include "Report.hh"
 #include "Network.hh"
 #include "PortDirection.hh"
@@ -201,13 +202,19 @@ Genclks::ensureInsertionDelays()
     // insertion delay, so sort the clocks by source pin level.
     sort(gclks, ClockPinMaxLevelLess(this));
 
-    ClockSeq::Iterator gclk_iter(gclks);
-    while (gclk_iter.hasNext()) {
-      Clock *gclk = gclk_iter.next();
-      if (gclk->masterClk()) {
-	findInsertionDelays(gclk);
-	recordSrcPaths(gclk);
-      }
+    ClockSeq master_gclks;
+    for (Clock *gclk : gclks) {
+      if (gclk->masterClk())
+        master_gclks.push_back(gclk);
+    }
+    VertexSetSeq fanins = findFanins(master_gclks);
+
+    // Source path searches are run in level order because a generated
+    // clock inherits the source paths of a generated master clock.
+    for (size_t i = 0; i < master_gclks.size(); i++) {
+      Clock *gclk = master_gclks[i];
+      findInsertionDelays(gclk, fanins[i]);
+      recordSrcPaths(gclk);
     }
 
     stats.report("Find generated clk insertion delays");
@@ -397,39 +404,86 @@ GenClkFaninSrchPred::searchTo(const Vertex *)
   return true;
 }
 
+// The fanin searches only read the graph and each one has its own
+// result set, so the searches for different clocks run in parallel.
+VertexSetSeq
+Genclks::findFanins(const ClockSeq &gclks)
+{
+  VertexSetSeq fanins(gclks.size());
+  for (size_t i = 0; i < gclks.size(); i++)
+    fanins[i] = new VertexSet(graph_);
+  if (thread_count_ == 1 || gclks.size() == 1) {
+    for (size_t i = 0; i < gclks.size(); i++)
+      findFanin(gclks[i], fanins[i]);
+  }
+  else {
+    for (size_t i = 0; i < gclks.size(); i++) {
+      Clock *gclk = gclks[i];
+      VertexSet *gclk_fanins = fanins[i];
+      dispatch_queue_->dispatch( [this, gclk, gclk_fanins](int) {
+        findFanin(gclk, gclk_fanins);
+      });
+    }
+    dispatch_queue_->finishTasks();
+  }
+  return fanins;
+}
+
 void
 Genclks::findFanin(Clock *gclk,
 		   // Return value.
 		   VertexSet *fanins)
 {
   // Search backward from generated clock source pin to a clock pin.
+  // Use a private work list instead of a BfsBkwdIterator so the search
+  // does not touch the shared vertex bfs queue flags.
   GenClkFaninSrchPred srch_pred(gclk, this);
-  BfsBkwdIterator iter(BfsIndex::other, &srch_pred, this);
-  seedClkVertices(gclk, iter, fanins);
-  while (iter.hasNext()) {
-    Vertex *vertex = iter.next();
+  VertexSeq queue;
+  seedClkVertices(gclk, queue, fanins);
+  while (!queue.empty()) {
+    Vertex *vertex = queue.back();
+    queue.pop_back();
     if (!fanins->hasKey(vertex)) {
       fanins->insert(vertex);
       debugPrint(debug_, "genclk", 2, "gen clk %s fanin %s",
                  gclk->name(), vertex->name(sdc_network_));
-      iter.enqueueAdjacentVertices(vertex);
+      enqueueFaninVertices(vertex, srch_pred, queue);
     }
   }
 }
 
 void
 Genclks::seedClkVertices(Clock *clk,
-			 BfsBkwdIterator &iter,
+			 VertexSeq &queue,
 			 VertexSet *fanins)
 {
+  GenClkFaninSrchPred srch_pred(clk, this);
   for (const Pin *pin : clk->leafPins()) {
     Vertex *vertex, *bidirect_drvr_vertex;
     graph_->pinVertices(pin, vertex, bidirect_drvr_vertex);
     fanins->insert(vertex);
-    iter.enqueueAdjacentVertices(vertex);
+    enqueueFaninVertices(vertex, srch_pred, queue);
     if (bidirect_drvr_vertex) {
       fanins->insert(bidirect_drvr_vertex);
-      iter.enqueueAdjacentVertices(bidirect_drvr_vertex);
+      enqueueFaninVertices(bidirect_drvr_vertex, srch_pred, queue);
+    }
+  }
+}
+
+// Same edge filtering as BfsBkwdIterator::enqueueAdjacentVertices.
+void
+Genclks::enqueueFaninVertices(Vertex *vertex,
+                              SearchPred &srch_pred,
+                              VertexSeq &queue)
+{
+  if (srch_pred.searchTo(vertex)) {
+    VertexInEdgeIterator edge_iter(vertex, graph_);
+    while (edge_iter.hasNext()) {
+      Edge *edge = edge_iter.next();
+      Vertex *from_vertex = edge->from(graph_);
+      if (srch_pred.searchFrom(from_vertex)
+	  && srch_pred.searchThru(edge))
+	queue.push_back(from_vertex);
     }
   }
 }
@@ -512,11 +566,12 @@ GenClkInsertionSearchPred::isNonGeneratedClkPin(const Pin *pin) const
 ////////////////////////////////////////////////////////////////
 
 void
-Genclks::findInsertionDelays(Clock *gclk)
+Genclks::findInsertionDelays(Clock *gclk,
+                             VertexSet *fanins)
 {
   debugPrint(debug_, "genclk", 2, "find gen clk %s insertion",
              gclk->name());
-  GenclkInfo *genclk_info = makeGenclkInfo(gclk);
+  GenclkInfo *genclk_info = makeGenclkInfo(gclk, fanins);
   FilterPath *src_filter = genclk_info->srcFilter();
   GenClkInsertionSearchPred srch_pred(gclk, nullptr, genclk_info, this);
   BfsFwdIterator insert_iter(BfsIndex::other, &srch_pred, this);
@@ -530,12 +585,11 @@ Genclks::findInsertionDelays(Clock *gclk)
 }
 
 GenclkInfo *
-Genclks::makeGenclkInfo(Clock *gclk)
+Genclks::makeGenclkInfo(Clock *gclk,
+                        VertexSet *fanins)
 {
   FilterPath *src_filter = makeSrcFilter(gclk);
   Level gclk_level = clkPinMaxLevel(gclk);
-  VertexSet *fanins = new VertexSet(graph_);
-  findFanin(gclk, fanins);
   GenclkInfo *genclk_info = new GenclkInfo(gclk, gclk_level, fanins,
 					    src_filter);
   genclk_info_map_.insert(gclk, genclk_info);
@@ -836,8 +890,7 @@ Genclks::findSrcArrivals(Clock *gclk,
   arrival_visitor.init(true, &eval_pred);
   // This cannot restrict the search level because loops in the clock tree
   // can circle back to the generated clock src pin.
-  // Parallel visit is slightly slower (at last check).
-  insert_iter.visit(levelize_->maxLevel(), &arrival_visitor);
+  insert_iter.visitParallel(levelize_->maxLevel(), &arrival_visitor);
 }
 
 // Copy existing generated clock source paths from vertex to tag_bldr.
@@ -850,11 +903,10 @@ Genclks::copyGenClkSrcPaths(Vertex *vertex,
     PathVertexRep *prev_paths = graph_->prevPaths(vertex);
     TagGroup *tag_group = search_->tagGroup(vertex);
     if (tag_group) {
-      ArrivalMap::Iterator arrival_iter(tag_group->arrivalMap());
-      while (arrival_iter.hasNext()) {
-        Tag *tag;
-        int arrival_index;
-        arrival_iter.next(tag, arrival_index);
+      for (int arrival_index = 0;
+           arrival_index < tag_group->arrivalCount();
+           arrival_index++) {
+        Tag *tag = tag_group->arrivalTag(arrival_index);
         if (tag->isGenClkSrcPath()) {
           Arrival arrival = arrivals[arrival_index];
           PathVertexRep *prev_path = prev_paths
@@ -0,0 +1,199 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2024, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include "GraphPartition.hh"
+
+#include <algorithm>
+
+#include "Report.hh"
+#include "TimingRole.hh"
+#include "Graph.hh"
+
+namespace sta {
+
+GraphPartition::GraphPartition(int partition_count,
+                               const StaState *sta) :
+  StaState(sta),
+  partition_count_(std::max(partition_count, 1)),
+  partition_size_(0),
+  current_partition_(0)
+{
+}
+
+// Fanout cone clustering. Cones are grown depth first from the
+// startpoints (ports and register outputs) and stop at register clock
+// pins and timing checks, so a cone is the logic between registers.
+// Vertices are assigned to the current partition in visit order until
+// it is full, which keeps the vertices of a cone in as few partitions
+// as possible.
+void
+GraphPartition::partitionGraph()
+{
+  size_t vertex_count = graph_->vertexCount();
+  partition_size_ = (vertex_count + partition_count_ - 1) / partition_count_;
+  current_partition_ = 0;
+  vertex_counts_.assign(partition_count_, 0);
+  vertex_partitions_.assign(vertex_count + 1, -1);
+
+  VertexSeq starts;
+  VertexIterator vertex_iter(graph_);
+  while (vertex_iter.hasNext()) {
+    Vertex *vertex = vertex_iter.next();
+    if (isStart(vertex))
+      starts.push_back(vertex);
+  }
+  for (Vertex *start : starts)
+    visitFanout(start);
+  // Vertices on loops or only reachable through register clock pins.
+  VertexIterator vertex_iter2(graph_);
+  while (vertex_iter2.hasNext())
+    visitFanout(vertex_iter2.next());
+  findBoundaries();
+}
+
+bool
+GraphPartition::isStart(Vertex *vertex) const
+{
+  if (!vertex->hasFanin())
+    return true;
+  VertexInEdgeIterator edge_iter(vertex, graph_);
+  while (edge_iter.hasNext()) {
+    Edge *edge = edge_iter.next();
+    if (edge->role() == TimingRole::regClkToQ())
+      return true;
+  }
+  return false;
+}
+
+void
+GraphPartition::visitFanout(Vertex *start)
+{
+  VertexSeq stack;
+  if (partition(start) == -1) {
+    assignPartition(start);
+    stack.push_back(start);
+  }
+  while (!stack.empty()) {
+    Vertex *vertex = stack.back();
+    stack.pop_back();
+    if (vertex->isRegClk())
+      continue;
+    VertexOutEdgeIterator edge_iter(vertex, graph_);
+    while (edge_iter.hasNext()) {
+      Edge *edge = edge_iter.next();
+      Vertex *to_vertex = edge->to(graph_);
+      if (!edge->role()->isTimingCheck()
+          && partition(to_vertex) == -1) {
+        assignPartition(to_vertex);
+        stack.push_back(to_vertex);
+      }
+    }
+  }
+}
+
+void
+GraphPartition::assignPartition(Vertex *vertex)
+{
+  if (vertex_counts_[current_partition_] >= partition_size_
+      && current_partition_ < partition_count_ - 1)
+    current_partition_++;
+  VertexId vertex_id = graph_->id(vertex);
+  if (vertex_id >= vertex_partitions_.size())
+    vertex_partitions_.resize(vertex_id + 1, -1);
+  vertex_partitions_[vertex_id] = current_partition_;
+  vertex_counts_[current_partition_]++;
+}
+
+void
+GraphPartition::findBoundaries()
+{
+  boundary_in_edge_counts_.assign(partition_count_, 0);
+  boundary_out_vertex_counts_.assign(partition_count_, 0);
+  VertexIterator vertex_iter(graph_);
+  while (vertex_iter.hasNext()) {
+    Vertex *from_vertex = vertex_iter.next();
+    int from_partition = partition(from_vertex);
+    bool boundary_out = false;
+    VertexOutEdgeIterator edge_iter(from_vertex, graph_);
+    while (edge_iter.hasNext()) {
+      Edge *edge = edge_iter.next();
+      Vertex *to_vertex = edge->to(graph_);
+      int to_partition = partition(to_vertex);
+      if (to_partition != from_partition
+          && to_partition >= 0) {
+        boundary_in_edge_counts_[to_partition]++;
+        boundary_out = true;
+      }
+    }
+    if (boundary_out && from_partition >= 0)
+      boundary_out_vertex_counts_[from_partition]++;
+  }
+}
+
+int
+GraphPartition::partition(const Vertex *vertex) const
+{
+  VertexId vertex_id = graph_->id(vertex);
+  if (vertex_id < vertex_partitions_.size())
+    return vertex_partitions_[vertex_id];
+  else
+    return -1;
+}
+
+size_t
+GraphPartition::vertexCount(int partition) const
+{
+  return vertex_counts_[partition];
+}
+
+size_t
+GraphPartition::boundaryInEdgeCount(int partition) const
+{
+  return boundary_in_edge_counts_[partition];
+}
+
+size_t
+GraphPartition::boundaryOutVertexCount(int partition) const
+{
+  return boundary_out_vertex_counts_[partition];
+}
+
+void
+GraphPartition::report() const
+{
+  report_->reportLine("Partition   Vertices  Boundary In  Boundary Out");
+  report_->reportLine("-----------------------------------------------");
+  size_t vertex_total = 0;
+  size_t boundary_total = 0;
+  for (int partition = 0; partition < partition_count_; partition++) {
+    report_->reportLine("%9d %10zu %12zu %13zu",
+                        partition,
+                        vertexCount(partition),
+                        boundaryInEdgeCount(partition),
+                        boundaryOutVertexCount(partition));
+    vertex_total += vertexCount(partition);
+    boundary_total += boundaryOutVertexCount(partition);
+  }
+  report_->reportLine("-----------------------------------------------");
+  report_->reportLine("Boundary vertices %zu of %zu (%.1f%%)",
+                      boundary_total,
+                      vertex_total,
+                      vertex_total
+                      ? boundary_total * 100.0 / vertex_total
+                      : 0.0);
+}
+
+} // namespace
@@ -113,7 +113,7 @@ PathVertex::init(Vertex *vertex,
   TagGroup *tag_group = search->tagGroup(vertex);
   if (tag_group) {
     bool arrival_exists;
-    tag_group->arrivalIndex(tag, arrival_index_, arrival_exists);
+    tag_group->arrivalIndex(tag, sta, arrival_index_, arrival_exists);
     if (arrival_exists) {
       vertex_ = vertex;
       tag_ = tag;
@@ -256,8 +256,11 @@ PathVertex::required(const StaState *sta) const
 {
   if (tag_) {
     Required *requireds = sta->graph()->requireds(vertex_);
-    if (requireds)
-      return requireds[arrival_index_];
+    if (requireds) {
+      TagGroup *tag_group = sta->search()->tagGroup(vertex_);
+      return requireds[tag_group->requiredIndex(arrival_index_,
+                                                 vertex_->sharedRequireds())];
+    }
   }
   return delayInitValue(minMax(sta)->opposite());
 }
@@ -267,18 +270,18 @@ PathVertex::setRequired(const Required &required,
 			const StaState *sta)
 {
   Graph *graph = sta->graph();
-  Required *requireds = graph->requireds(vertex_);
-  if (requireds == nullptr) {
-    const Search *search = sta->search();
-    TagGroup *tag_group = search->tagGroup(vertex_);
-    if (tag_group) {
-      int arrival_count = tag_group->arrivalCount();
-      requireds = graph->makeRequireds(vertex_, arrival_count);
-    }
-    else
-      sta->report()->error(1402, "missing requireds.");
+  const Search *search = sta->search();
+  TagGroup *tag_group = search->tagGroup(vertex_);
+  if (tag_group) {
+    Required *requireds = graph->requireds(vertex_);
+    bool shared = vertex_->sharedRequireds();
+    if (requireds == nullptr)
+      requireds = graph->makeRequireds(vertex_,
+                                       tag_group->requiredCount(shared));
+    requireds[tag_group->requiredIndex(arrival_index_, shared)] = required;
   }
-  requireds[arrival_index_] = required;
+  else
+    sta->report()->error(1402, "missing requireds.");
 }
 
 bool
@@ -486,13 +489,11 @@ VertexPathIterator::VertexPathIterator(Vertex *vertex,
   vertex_(vertex),
   rf_(nullptr),
   path_ap_(nullptr),
-  min_max_(nullptr)
+  min_max_(nullptr),
+  tag_group_(search_->tagGroup(vertex)),
+  arrival_index_(0)
 {
-  TagGroup *tag_group = search_->tagGroup(vertex);
-  if (tag_group) {
-    arrival_iter_.init(tag_group->arrivalMap());
-    findNext();
-  }
+  findNext();
 }
 
 // Iterate over vertex paths with the same transition and
@@ -505,13 +506,11 @@ VertexPathIterator::VertexPathIterator(Vertex *vertex,
   vertex_(vertex),
   rf_(rf),
   path_ap_(path_ap),
-  min_max_(nullptr)
+  min_max_(nullptr),
+  tag_group_(search_->tagGroup(vertex)),
+  arrival_index_(0)
 {
-  TagGroup *tag_group = search_->tagGroup(vertex);
-  if (tag_group) {
-    arrival_iter_.init(tag_group->arrivalMap());
-    findNext();
-  }
+  findNext();
 }
 
 VertexPathIterator::VertexPathIterator(Vertex *vertex,
@@ -522,13 +521,11 @@ VertexPathIterator::VertexPathIterator(Vertex *vertex,
   vertex_(vertex),
   rf_(rf),
   path_ap_(nullptr),
-  min_max_(min_max)
+  min_max_(min_max),
+  tag_group_(search_->tagGroup(vertex)),
+  arrival_index_(0)
 {
-  TagGroup *tag_group = search_->tagGroup(vertex);
-  if (tag_group) {
-    arrival_iter_.init(tag_group->arrivalMap());
-    findNext();
-  }
+  findNext();
 }
 
 VertexPathIterator::VertexPathIterator(Vertex *vertex,
@@ -540,13 +537,11 @@ VertexPathIterator::VertexPathIterator(Vertex *vertex,
   vertex_(vertex),
   rf_(rf),
   path_ap_(path_ap),
-  min_max_(min_max)
+  min_max_(min_max),
+  tag_group_(search_->tagGroup(vertex)),
+  arrival_index_(0)
 {
-  TagGroup *tag_group = search_->tagGroup(vertex);
-  if (tag_group) {
-    arrival_iter_.init(tag_group->arrivalMap());
-    findNext();
-  }
+  findNext();
 }
 
 VertexPathIterator::~VertexPathIterator()
@@ -562,10 +557,10 @@ VertexPathIterator::hasNext()
 void
 VertexPathIterator::findNext()
 {
-  while (arrival_iter_.hasNext()) {
-    Tag *tag;
-    int arrival_index;
-    arrival_iter_.next(tag, arrival_index);
+  while (tag_group_
+         && arrival_index_ < tag_group_->arrivalCount()) {
+    int arrival_index = arrival_index_++;
+    Tag *tag = tag_group_->arrivalTag(arrival_index);
     if ((rf_ == nullptr
 	 || tag->rfIndex() == rf_->index())
 	&& (path_ap_ == nullptr
@@ -140,7 +140,7 @@ PathVertexRep::arrival(const StaState *sta) const
   if (tag_group) {
     int arrival_index;
     bool arrival_exists;
-    tag_group->arrivalIndex(tag, arrival_index, arrival_exists);
+    tag_group->arrivalIndex(tag, sta, arrival_index, arrival_exists);
     if (!arrival_exists)
       sta->report()->critical(1420, "tag group missing tag");
     Arrival *arrivals = graph->arrivals(vertex);
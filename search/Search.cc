@@ -20,6 +20,7 @@
 #include <cmath> // abs
 
 #include "Mutex.hh"
+#include "DispatchQueue.hh"
 #include "Report.hh"
 #include "Debug.hh"
 #include "Stats.hh"
@@ -134,11 +135,8 @@ DynLoopSrchPred::hasPendingLoopPaths(Edge *edge,
     Corners *corners = search->corners();
     Vertex *from_vertex = edge->from(graph);
     TagGroup *prev_tag_group = search->tagGroup(from_vertex);
-    ArrivalMap::Iterator arrival_iter(tag_bldr_->arrivalMap());
-    while (arrival_iter.hasNext()) {
-      Tag *from_tag;
-      int arrival_index;
-      arrival_iter.next(from_tag, arrival_index);
+    for (const TagArrival &tag_arrival : tag_bldr_->tagArrivals()) {
+      Tag *from_tag = tag_arrival.tag;
       if (from_tag->isLoop()) {
 	// Loop false path exceptions apply to rise/fall edges so to_rf
 	// does not matter.
@@ -148,7 +146,7 @@ DynLoopSrchPred::hasPendingLoopPaths(Edge *edge,
 				      path_ap->pathMinMax(), path_ap);
 	if (to_tag
 	    && (prev_tag_group == nullptr
-		|| !prev_tag_group->hasTag(from_tag)))
+		|| !prev_tag_group->hasTag(from_tag, search)))
 	  return true;
       }
     }
@@ -261,6 +259,7 @@ Search::initVars()
   unconstrained_paths_ = false;
   crpr_path_pruning_enabled_ = true;
   crpr_approx_missing_requireds_ = true;
+  requireds_worst_per_clk_ = false;
 }
 
 Search::~Search()
@@ -344,6 +343,16 @@ Search::setCrprApproxMissingRequireds(bool enabled)
   crpr_approx_missing_requireds_ = enabled;
 }
 
+void
+Search::setRequiredsWorstPerClk(bool enabled)
+{
+  if (enabled != requireds_worst_per_clk_) {
+    // Tag groups map arrivals to requireds when they are made.
+    arrivalsInvalid();
+    requireds_worst_per_clk_ = enabled;
+  }
+}
+
 void
 Search::deleteTags()
 {
@@ -1212,13 +1221,13 @@ Search::arrivalsChanged(Vertex *vertex,
   if (arrivals1) {
     TagGroup *tag_group = tagGroup(vertex);
     if (tag_group == nullptr
-        || tag_group->arrivalMap()->size() != tag_bldr->arrivalMap()->size())
+        || static_cast<size_t>(tag_group->arrivalCount())
+           != tag_bldr->tagArrivals().size())
       return true;
-    ArrivalMap::Iterator arrival_iter1(tag_group->arrivalMap());
-    while (arrival_iter1.hasNext()) {
-      Tag *tag1;
-      int arrival_index1;
-      arrival_iter1.next(tag1, arrival_index1);
+    for (int arrival_index1 = 0;
+         arrival_index1 < tag_group->arrivalCount();
+         arrival_index1++) {
+      Tag *tag1 = tag_group->arrivalTag(arrival_index1);
       Arrival &arrival1 = arrivals1[arrival_index1];
       Tag *tag2;
       Arrival arrival2;
@@ -1300,12 +1309,13 @@ ArrivalVisitor::visitFromToPath(const Pin *,
 void
 ArrivalVisitor::pruneCrprArrivals()
 {
-  ArrivalMap::Iterator arrival_iter(tag_bldr_->arrivalMap());
+  const TagArrivalSeq &tag_arrivals = tag_bldr_->tagArrivals();
   CheckCrpr *crpr = search_->checkCrpr();
-  while (arrival_iter.hasNext()) {
-    Tag *tag;
-    int arrival_index;
-    arrival_iter.next(tag, arrival_index);
+  // Iterate backwards so deleting an arrival does not move the
+  // entries that have not been visited yet.
+  for (int i = tag_arrivals.size() - 1; i >= 0; i--) {
+    Tag *tag = tag_arrivals[i].tag;
+    int arrival_index = tag_arrivals[i].arrival_index;
     ClkInfo *clk_info = tag->clkInfo();
     if (!tag->isClock()
 	&& clk_info->hasCrprClkPin()) {
@@ -2693,7 +2703,8 @@ Search::setVertexArrivals(Vertex *vertex,
 	requiredInvalid(vertex);
         if (tag_group != prev_tag_group)
           // Requireds can only be reused if the tag group is unchanged.
-          graph_->deleteRequireds(vertex, prev_tag_group->arrivalCount());
+          graph_->deleteRequireds(vertex,
+                                  prev_tag_group->requiredCount(vertex->sharedRequireds()));
       }
     }
     else {
@@ -2702,7 +2713,8 @@ Search::setVertexArrivals(Vertex *vertex,
         graph_->deleteArrivals(vertex, prev_arrival_count);
         if (has_requireds) {
           requiredInvalid(vertex);
-          graph_->deleteRequireds(vertex, prev_arrival_count);
+          graph_->deleteRequireds(vertex,
+                                  prev_tag_group->requiredCount(vertex->sharedRequireds()));
         }
       }
       Arrival *arrivals = graph_->makeArrivals(vertex, arrival_count);
@@ -2727,16 +2739,17 @@ Search::reportArrivals(Vertex *vertex) const
   Required *requireds = graph_->requireds(vertex);
   if (tag_group) {
     report_->reportLine("Group %u", tag_group->index());
-    ArrivalMap::Iterator arrival_iter(tag_group->arrivalMap());
-    while (arrival_iter.hasNext()) {
-      Tag *tag;
-      int arrival_index;
-      arrival_iter.next(tag, arrival_index);
+    for (int arrival_index = 0;
+         arrival_index < tag_group->arrivalCount();
+         arrival_index++) {
+      Tag *tag = tag_group->arrivalTag(arrival_index);
       PathAnalysisPt *path_ap = tag->pathAnalysisPt(this);
       const RiseFall *rf = tag->transition();
       const char *req = "?";
       if (requireds)
-        req = delayAsString(requireds[arrival_index], this);
+        req = delayAsString(requireds[tag_group->requiredIndex(arrival_index,
+                                                               vertex->sharedRequireds())],
+                            this);
       bool report_clk_prev = false;
       const char *clk_prev = "";
       if (report_clk_prev
@@ -2791,7 +2804,7 @@ Search::reportTagGroups() const
                           i,
                           tag_group->hash(),
                           tag_group->hash() % tag_group_set_->bucket_count());
-      tag_group->reportArrivalMap(this);
+      tag_group->reportArrivalEntries(this);
     }
   }
   size_t long_hash = 0;
@@ -2868,6 +2881,7 @@ Search::findTag(const RiseFall *rf,
     tag = new Tag(tag_index, rf->index(), path_ap->index(),
                   clk_info, is_clk, input_delay, is_segment_start,
                   new_states, true, this);
+    Stats::incrCount(StatsCount::tags_created);
     own_states = false;
     // Make sure tag can be indexed in tags_ before it is visible to
     // other threads via tag_set_.
@@ -3331,6 +3345,8 @@ Search::seedRequiredEnqueueFanin(Vertex *vertex)
 ////////////////////////////////////////////////////////////////
 
 RequiredCmp::RequiredCmp() :
+  tag_group_(nullptr),
+  shared_requireds_(false),
   have_requireds_(false)
 {
   requireds_.reserve(10);
@@ -3342,17 +3358,21 @@ RequiredCmp::requiredsInit(Vertex *vertex,
 {
   Search *search = sta->search();
   TagGroup *tag_group = search->tagGroup(vertex);
+  tag_group_ = tag_group;
+  // Endpoint requireds are only shared between tags that differ by
+  // CRPR clock pin so endpoint slacks stay exact.
+  shared_requireds_ = search->requiredsWorstPerClk()
+    && !search->isEndpoint(vertex);
   if (tag_group) {
-    requireds_.resize(tag_group->arrivalCount());
-    ArrivalMap *arrival_entries = tag_group->arrivalMap();
-    ArrivalMap::Iterator arrival_iter(arrival_entries);
-    while (arrival_iter.hasNext()) {
-      Tag *tag;
-      int arrival_index;
-      arrival_iter.next(tag, arrival_index);
+    requireds_.resize(tag_group->requiredCount(shared_requireds_));
+    for (int arrival_index = 0;
+         arrival_index < tag_group->arrivalCount();
+         arrival_index++) {
+      Tag *tag = tag_group->arrivalTag(arrival_index);
       PathAnalysisPt *path_ap = tag->pathAnalysisPt(sta);
       const MinMax *min_max = path_ap->pathMinMax();
-      requireds_[arrival_index] = delayInitValue(min_max->opposite());
+      requireds_[requiredIndex(arrival_index)] =
+        delayInitValue(min_max->opposite());
     }
   }
   else
@@ -3366,8 +3386,9 @@ RequiredCmp::requiredSet(int arrival_index,
 			 const MinMax *min_max,
 			 const StaState *sta)
 {
-  if (delayGreater(required, requireds_[arrival_index], min_max, sta)) {
-    requireds_[arrival_index] = required;
+  int required_index = requiredIndex(arrival_index);
+  if (delayGreater(required, requireds_[required_index], min_max, sta)) {
+    requireds_[required_index] = required;
     have_requireds_ = true;
   }
 }
@@ -3378,9 +3399,21 @@ RequiredCmp::requiredsSave(Vertex *vertex,
 {
   bool requireds_changed = false;
   bool prev_reqs = vertex->hasRequireds();
+  if (prev_reqs
+      && have_requireds_
+      && vertex->sharedRequireds() != shared_requireds_) {
+    // The vertex became (or stopped being) an endpoint, so the requireds
+    // layout changed.
+    TagGroup *tag_group = sta->search()->tagGroup(vertex);
+    sta->graph()->deleteRequireds(vertex,
+                                  tag_group->requiredCount(vertex->sharedRequireds()));
+    prev_reqs = false;
+  }
   if (have_requireds_) {
-    if (!prev_reqs)
+    if (!prev_reqs) {
+      vertex->setSharedRequireds(shared_requireds_);
       requireds_changed = true;
+    }
     Debug *debug = sta->debug();
     VertexPathIterator path_iter(vertex, sta);
     while (path_iter.hasNext()) {
@@ -3388,7 +3421,7 @@ RequiredCmp::requiredsSave(Vertex *vertex,
       int arrival_index;
       bool arrival_exists;
       path->arrivalIndex(arrival_index, arrival_exists);
-      Required req = requireds_[arrival_index];
+      Required req = requireds_[requiredIndex(arrival_index)];
       if (prev_reqs) {
 	Required prev_req = path->required(sta);
 	if (!delayEqual(prev_req, req)) {
@@ -3413,8 +3446,8 @@ RequiredCmp::requiredsSave(Vertex *vertex,
     if (tag_group == nullptr)
       requireds_changed = true;
     else {
-      int arrival_count = tag_group->arrivalCount();
-      graph->deleteRequireds(vertex, arrival_count);
+      graph->deleteRequireds(vertex,
+                             tag_group->requiredCount(vertex->sharedRequireds()));
       requireds_changed = true;
     }
   }
@@ -3424,7 +3457,13 @@ RequiredCmp::requiredsSave(Vertex *vertex,
 Required
 RequiredCmp::required(int arrival_index)
 {
-  return requireds_[arrival_index];
+  return requireds_[requiredIndex(arrival_index)];
+}
+
+int
+RequiredCmp::requiredIndex(int arrival_index) const
+{
+  return tag_group_->requiredIndex(arrival_index, shared_requireds_);
 }
 
 ////////////////////////////////////////////////////////////////
@@ -3463,10 +3502,12 @@ RequiredVisitor::visit(Vertex *vertex)
     visit_path_ends_->visitPathEnds(vertex, &seeder);
   }
   bool changed = required_cmp_->requiredsSave(vertex, this);
-  search_->tnsInvalid(vertex);
-
-  if (changed)
+  if (changed) {
+    // Arrival changes invalidate the tns when they are propagated so
+    // endpoints with unchanged requireds keep their slacks.
+    search_->tnsInvalid(vertex);
     search_->requiredIterator()->enqueueAdjacentVertices(vertex);
+  }
 }
 
 bool
@@ -3500,7 +3541,7 @@ RequiredVisitor::visitFromToPath(const Pin *,
     const MinMax *req_min = min_max->opposite();
     TagGroup *to_tag_group = search_->tagGroup(to_vertex);
     // Check to see if to_tag was pruned.
-    if (to_tag_group && to_tag_group->hasTag(to_tag)) {
+    if (to_tag_group && to_tag_group->hasTag(to_tag, this)) {
       PathVertex to_path(to_vertex, to_tag, this);
       Required to_required = to_path.required(this);
       Required from_required = to_required - arc_delay;
@@ -3726,21 +3767,26 @@ Search::tnsInvalid(Vertex *vertex)
 void
 Search::updateInvalidTns()
 {
-  PathAPIndex path_ap_count = corners_->pathAnalysisPtCount();
+  VertexSeq endpoints;
   for (Vertex *vertex : *invalid_tns_) {
     // Network edits can change endpointedness since tnsInvalid was called.
     if (isEndpoint(vertex)) {
       debugPrint(debug_, "tns", 2, "update tns %s",
                  vertex->name(sdc_network_));
-      SlackSeq slacks(path_ap_count);
-      wnsSlacks(vertex, slacks);
-
-      if (tns_exists_)
-	updateTns(vertex, slacks);
-      if (worst_slacks_)
-	worst_slacks_->updateWorstSlacks(vertex, slacks);
+      endpoints.push_back(vertex);
     }
   }
+  // Finding the endpoint slacks dominates, so do it in parallel and
+  // update the totals afterwards.
+  Vector<SlackSeq> slacks;
+  wnsSlacks(endpoints, slacks);
+  for (size_t i = 0; i < endpoints.size(); i++) {
+    Vertex *vertex = endpoints[i];
+    if (tns_exists_)
+      updateTns(vertex, slacks[i]);
+    if (worst_slacks_)
+      worst_slacks_->updateWorstSlacks(vertex, slacks[i]);
+  }
   invalid_tns_->clear();
 }
 
@@ -3752,12 +3798,14 @@ Search::findTotalNegativeSlacks()
     tns_[i] = 0.0;
     tns_slacks_[i].clear();
   }
-  for (Vertex *vertex : *endpoints()) {
-    // No locking required.
-    SlackSeq slacks(path_ap_count);
-    wnsSlacks(vertex, slacks);
-    for (PathAPIndex i = 0; i < path_ap_count; i++)
-      tnsIncr(vertex, slacks[i], i);
+  VertexSeq ends;
+  for (Vertex *vertex : *endpoints())
+    ends.push_back(vertex);
+  Vector<SlackSeq> slacks;
+  wnsSlacks(ends, slacks);
+  for (size_t i = 0; i < ends.size(); i++) {
+    for (PathAPIndex ap_index = 0; ap_index < path_ap_count; ap_index++)
+      tnsIncr(ends[i], slacks[i][ap_index], ap_index);
   }
   tns_exists_ = true;
 }
@@ -3959,13 +4007,93 @@ Search::wnsSlacks(Vertex *vertex,
   }
 }
 
+void
+Search::wnsSlacks(const VertexSeq &vertices,
+		  // Return values.
+		  Vector<SlackSeq> &slacks)
+{
+  PathAPIndex path_ap_count = corners_->pathAnalysisPtCount();
+  size_t vertex_count = vertices.size();
+  slacks.resize(vertex_count);
+  for (SlackSeq &vertex_slacks : slacks)
+    vertex_slacks.resize(path_ap_count);
+  size_t thread_count = thread_count_;
+  if (thread_count == 1 || vertex_count < thread_count) {
+    for (size_t i = 0; i < vertex_count; i++)
+      wnsSlacks(vertices[i], slacks[i]);
+  }
+  else {
+    size_t from = 0;
+    size_t chunk_size = vertex_count / thread_count;
+    for (size_t k = 0; k < thread_count; k++) {
+      // Last thread gets the left overs.
+      size_t to = (k == thread_count - 1) ? vertex_count : from + chunk_size;
+      dispatch_queue_->dispatch([=, &vertices, &slacks](int) {
+        for (size_t i = from; i < to; i++)
+          wnsSlacks(vertices[i], slacks[i]);
+      });
+      from = to;
+    }
+    dispatch_queue_->finishTasks();
+  }
+}
+
+void
+Search::wnsSlacks(const VertexSeq &vertices,
+		  PathAPIndex path_ap_index,
+		  // Return values.
+		  SlackSeq &slacks)
+{
+  size_t vertex_count = vertices.size();
+  slacks.resize(vertex_count);
+  size_t thread_count = thread_count_;
+  if (thread_count == 1 || vertex_count < thread_count) {
+    for (size_t i = 0; i < vertex_count; i++)
+      slacks[i] = wnsSlack(vertices[i], path_ap_index);
+  }
+  else {
+    size_t from = 0;
+    size_t chunk_size = vertex_count / thread_count;
+    for (size_t k = 0; k < thread_count; k++) {
+      // Last thread gets the left overs.
+      size_t to = (k == thread_count - 1) ? vertex_count : from + chunk_size;
+      dispatch_queue_->dispatch([=, &vertices, &slacks](int) {
+        for (size_t i = from; i < to; i++)
+          slacks[i] = wnsSlack(vertices[i], path_ap_index);
+      });
+      from = to;
+    }
+    dispatch_queue_->finishTasks();
+  }
+}
+
+// Only the path ends of path_ap_index are visited.
 Slack
 Search::wnsSlack(Vertex *vertex,
 		 PathAPIndex path_ap_index)
 {
+  Slack slack_init = MinMax::min()->initValue();
   PathAPIndex path_ap_count = corners_->pathAnalysisPtCount();
-  SlackSeq slacks(path_ap_count);
-  wnsSlacks(vertex, slacks);
+  SlackSeq slacks(path_ap_count, slack_init);
+  if (hasFanout(vertex, search_adj_, graph_)) {
+    const PathAnalysisPt *path_ap = corners_->findPathAnalysisPt(path_ap_index);
+    FindEndSlackVisitor end_visitor(slacks, this);
+    visit_path_ends_->visitPathEnds(vertex, path_ap->corner(),
+				    path_ap->pathMinMax()->asMinMaxAll(),
+				    false, &end_visitor);
+  }
+  else {
+    VertexPathIterator path_iter(vertex, this);
+    while (path_iter.hasNext()) {
+      Path *path = path_iter.next();
+      if (path->pathAnalysisPtIndex(this) == path_ap_index) {
+	const Slack path_slack = path->slack(this);
+	if (!path->tag(this)->isFilter()
+	    && delayLess(path_slack, slacks[path_ap_index], this))
+	  slacks[path_ap_index] = path_slack;
+      }
+    }
+  }
   return slacks[path_ap_index];
 }
 
@@ -22,6 +22,7 @@
 #include "Debug.hh"
 #include "Report.hh"
 #include "Stats.hh"
+#include "DispatchQueue.hh"
 #include "FuncExpr.hh"
 #include "TimingRole.hh"
 #include "TimingArc.hh"
@@ -79,6 +80,12 @@ Sim::functionSense(const FuncExpr *expr,
   debugPrint(debug_, "sim", 4, "find sense pin %s %s",
              network_->pathName(input_pin),
              expr->asString());
+  const FuncTruthTable *table = expr->truthTable();
+  if (table) {
+    TimingSense sense = truthTableSense(table, input_pin, inst);
+    debugPrint(debug_, "sim", 4, " %s", timingSenseString(sense));
+    return sense;
+  }
   bool increasing, decreasing;
   {
     UniqueLock lock(bdd_lock_);
@@ -111,6 +118,9 @@ LogicValue
 Sim::evalExpr(const FuncExpr *expr,
 	      const Instance *inst)
 {
+  const FuncTruthTable *table = expr->truthTable();
+  if (table)
+    return evalTruthTable(table, inst);
   UniqueLock lock(bdd_lock_);
   DdNode *bdd = funcBddSim(expr, inst);
   LogicValue value = LogicValue::unknown;
@@ -253,6 +263,9 @@ Sim::functionSense(const FuncExpr *expr,
 		   const Pin *input_pin,
 		   const Instance *inst)
 {
+  const FuncTruthTable *table = expr->truthTable();
+  if (table)
+    return truthTableSense(table, input_pin, inst);
   TimingSense sense = TimingSense::none;
   LogicValue value = LogicValue::unknown;
   functionSense(expr, input_pin, inst, sense, value);
@@ -399,11 +412,14 @@ LogicValue
 Sim::evalExpr(const FuncExpr *expr,
 	      const Instance *inst)
 {
+  const FuncTruthTable *table = expr->truthTable();
+  if (table)
+    return evalTruthTable(table, inst);
   switch (expr->op()) {
   case FuncExpr::op_port: {
     LibertyPort *port = expr->port();
     if (port) {
-      Pin *pin = network_->findPin(inst, port->name());
+      Pin *pin = network_->findPin(inst, port);
       if (pin)
         return logicValue(pin);
     }
@@ -441,6 +457,78 @@ logicNot(LogicValue value)
   return logic_not[int(value)];
 }
 
+// Minterms of a truth table input consistent with its value.
+static uint64_t
+truthTableValueMask(size_t input_index,
+		    LogicValue value)
+{
+  switch (value) {
+  case LogicValue::zero:
+    return ~FuncTruthTable::inputMask(input_index);
+  case LogicValue::one:
+    return FuncTruthTable::inputMask(input_index);
+  default:
+    return ~uint64_t(0);
+  }
+}
+
+// The function is constant if it has the same value for all of the
+// minterms consistent with the constant input pins.
+LogicValue
+Sim::evalTruthTable(const FuncTruthTable *table,
+		    const Instance *inst) const
+{
+  uint64_t minterms = table->mintermMask();
+  for (size_t i = 0; i < table->inputCount(); i++) {
+    // Internal ports don't have instance pins.
+    const Pin *pin = network_->findPin(inst, table->input(i));
+    if (pin)
+      minterms &= truthTableValueMask(i, logicValue(pin));
+  }
+  uint64_t ones = table->table() & minterms;
+  if (ones == 0)
+    return LogicValue::zero;
+  else if (ones == minterms)
+    return LogicValue::one;
+  else
+    return LogicValue::unknown;
+}
+
+TimingSense
+Sim::truthTableSense(const FuncTruthTable *table,
+		     const Pin *input_pin,
+		     const Instance *inst) const
+{
+  uint64_t minterms = table->mintermMask();
+  int input_index = -1;
+  for (size_t i = 0; i < table->inputCount(); i++) {
+    const Pin *pin = network_->findPin(inst, table->input(i));
+    if (pin) {
+      if (pin == input_pin)
+	input_index = i;
+      else
+	minterms &= truthTableValueMask(i, logicValue(pin));
+    }
+  }
+  if (input_index == -1)
+    return TimingSense::none;
+  // Minterms with the input zero where the function depends on it.
+  uint64_t sensitized = table->sensitivity(input_index)
+    & ~FuncTruthTable::inputMask(input_index)
+    & minterms;
+  uint64_t func = table->table();
+  bool increasing = (func & sensitized) == 0;
+  bool decreasing = (~func & sensitized) == 0;
+  if (increasing && decreasing)
+    return TimingSense::none;
+  else if (increasing)
+    return TimingSense::positive_unate;
+  else if (decreasing)
+    return TimingSense::negative_unate;
+  else
+    return TimingSense::non_unate;
+}
+
 void
 Sim::clear()
 {
@@ -1047,16 +1135,55 @@ Sim::clearInstSimValues(const Instance *inst)
 }
 
 // Annotate graph edges disabled by constant values.
+// The edge senses only depend on the pin values so they are found in
+// parallel. Setting them notifies the observer so that is serial.
 void
 Sim::annotateGraphEdges()
 {
-  for (const Instance *inst : instances_to_annotate_)
-    annotateVertexEdges(inst, true);
+  size_t inst_count = instances_to_annotate_.size();
+  size_t thread_count = thread_count_;
+  if (thread_count == 1 || inst_count < thread_count) {
+    for (const Instance *inst : instances_to_annotate_)
+      annotateVertexEdges(inst, true);
+  }
+  else {
+    InstanceSeq insts;
+    insts.reserve(inst_count);
+    for (const Instance *inst : instances_to_annotate_)
+      insts.push_back(inst);
+    std::vector<SimEdgeAnnotationSeq> annotations(inst_count);
+    size_t from = 0;
+    size_t chunk_size = inst_count / thread_count;
+    for (size_t k = 0; k < thread_count; k++) {
+      // Last thread gets the left overs.
+      size_t to = (k == thread_count - 1) ? inst_count : from + chunk_size;
+      dispatch_queue_->dispatch([=, &insts, &annotations](int) {
+        for (size_t i = from; i < to; i++)
+          findEdgeAnnotations(insts[i], true, annotations[i]);
+      });
+      from = to;
+    }
+    dispatch_queue_->finishTasks();
+    for (const SimEdgeAnnotationSeq &inst_annotations : annotations)
+      setEdgeAnnotations(inst_annotations);
+  }
 }
 
 void
 Sim::annotateVertexEdges(const Instance *inst,
 			 bool annotate)
+{
+  SimEdgeAnnotationSeq annotations;
+  findEdgeAnnotations(inst, annotate, annotations);
+  setEdgeAnnotations(annotations);
+}
+
+// Find the timing senses of the instance edges without changing them.
+void
+Sim::findEdgeAnnotations(const Instance *inst,
+			 bool annotate,
+			 // Return value.
+			 SimEdgeAnnotationSeq &annotations)
 {
   debugPrint(debug_, "sim", 4, "annotate %s %s",
              network_->pathName(inst),
@@ -1065,61 +1192,71 @@ Sim::annotateVertexEdges(const Instance *inst,
   while (pin_iter->hasNext()) {
     Pin *pin = pin_iter->next();
     Vertex *vertex = graph_->pinDrvrVertex(pin);
-    if (vertex)
-      annotateVertexEdges(inst, pin, vertex, annotate);
+    if (vertex) {
+      VertexInEdgeIterator edge_iter(vertex, graph_);
+      while (edge_iter.hasNext()) {
+	Edge *edge = edge_iter.next();
+	if (!edge->role()->isWire()) {
+	  Vertex *from_vertex = edge->from(graph_);
+	  Pin *from_pin = from_vertex->pin();
+	  TimingSense sense = TimingSense::unknown;
+	  bool is_disabled_cond = false;
+	  if (annotate) {
+	    // Set timing sense on edges in instances that have constant pins.
+	    if (logicZeroOne(from_vertex))
+	      sense = TimingSense::none;
+	    else
+	      sense = functionSense(inst, from_pin, pin);
+
+	    if (sense != TimingSense::none)
+	      // Disable conditional timing edges based on constant pins.
+	      is_disabled_cond = isCondDisabled(edge, inst, from_pin,
+						pin, network_,sim_)
+		// Disable mode conditional timing
+		// edges based on constant pins.
+		|| isModeDisabled(edge,inst,network_,sim_)
+		|| isTestDisabled(inst, from_pin, pin,
+				  network_, sim_);
+	  }
+	  annotations.push_back({edge, vertex, sense, is_disabled_cond});
+	}
+      }
+    }
   }
   delete pin_iter;
 }
 
+// Annotations for the edges to a vertex are adjacent.
 void
-Sim::annotateVertexEdges(const Instance *inst,
-			 const Pin *pin,
-			 Vertex *vertex,
-			 bool annotate)
+Sim::setEdgeAnnotations(const SimEdgeAnnotationSeq &annotations)
 {
+  Vertex *prev_vertex = nullptr;
   bool fanin_disables_changed = false;
-  VertexInEdgeIterator edge_iter(vertex, graph_);
-  while (edge_iter.hasNext()) {
-    Edge *edge = edge_iter.next();
-    if (!edge->role()->isWire()) {
-      Vertex *from_vertex = edge->from(graph_);
-      Pin *from_pin = from_vertex->pin();
-      TimingSense sense = TimingSense::unknown;
-      bool is_disabled_cond = false;
-      if (annotate) {
-	// Set timing sense on edges in instances that have constant pins.
-  	if (logicZeroOne(from_vertex))
-  	  sense = TimingSense::none;
- 	else
-	  sense = functionSense(inst, from_pin, pin);
-
-	if (sense != TimingSense::none)
-	  // Disable conditional timing edges based on constant pins.
-	  is_disabled_cond = isCondDisabled(edge, inst, from_pin, 
-					    pin, network_,sim_)
-	    // Disable mode conditional timing
-	    // edges based on constant pins.
-	    || isModeDisabled(edge,inst,network_,sim_)
-	    || isTestDisabled(inst, from_pin, pin,
-			      network_, sim_);
-      }
-      bool disables_changed = false;
-      if (sense != edge->simTimingSense()) {
-	edge->setSimTimingSense(sense);
-	disables_changed = true;
-	fanin_disables_changed = true;
-      }
-      if (is_disabled_cond != edge->isDisabledCond()) {
-	edge->setIsDisabledCond(is_disabled_cond);
-	disables_changed = true;
-	fanin_disables_changed = true;
-      }
-      if (observer_ && disables_changed)
-	observer_->fanoutEdgesChangeAfter(from_vertex);
+  for (const SimEdgeAnnotation &annotation : annotations) {
+    Edge *edge = annotation.edge;
+    Vertex *vertex = annotation.to_vertex;
+    if (vertex != prev_vertex) {
+      if (observer_ && fanin_disables_changed)
+	observer_->faninEdgesChangeAfter(prev_vertex);
+      prev_vertex = vertex;
+      fanin_disables_changed = false;
+    }
+    bool disables_changed = false;
+    if (annotation.sense != edge->simTimingSense()) {
+      edge->setSimTimingSense(annotation.sense);
+      disables_changed = true;
+      fanin_disables_changed = true;
+    }
+    if (annotation.is_disabled_cond != edge->isDisabledCond()) {
+      edge->setIsDisabledCond(annotation.is_disabled_cond);
+      disables_changed = true;
+      fanin_disables_changed = true;
     }
+    if (observer_ && disables_changed)
+      observer_->fanoutEdgesChangeAfter(edge->from(graph_));
   }
   if (observer_ && fanin_disables_changed)
-    observer_->faninEdgesChangeAfter(vertex);
+    observer_->faninEdgesChangeAfter(prev_vertex);
 }
 
 bool
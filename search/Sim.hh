@@ -18,6 +18,7 @@
 
 #include <queue>
 #include <mutex>
+#include <vector>
 
 #include "StaConfig.hh"  // CUDD
 #include "Map.hh"
@@ -30,10 +31,23 @@
 namespace sta {
 
 class SimObserver;
+class FuncTruthTable;
 
 typedef Map<const Pin*, LogicValue> PinValueMap;
 typedef std::queue<const Instance*> EvalQueue;
 
+// Timing sense found for an edge by Sim::findEdgeAnnotations.
+class SimEdgeAnnotation
+{
+public:
+  Edge *edge;
+  Vertex *to_vertex;
+  TimingSense sense;
+  bool is_disabled_cond;
+};
+
+typedef std::vector<SimEdgeAnnotation> SimEdgeAnnotationSeq;
+
 // Propagate constants from constraints and netlist tie high/low
 // connections thru gates.
 class Sim : public StaState
@@ -91,15 +105,21 @@ protected:
 		     // return values
 		     TimingSense &sense,
 		     LogicValue &value) const;
+  LogicValue evalTruthTable(const FuncTruthTable *table,
+			    const Instance *inst) const;
+  TimingSense truthTableSense(const FuncTruthTable *table,
+			      const Pin *input_pin,
+			      const Instance *inst) const;
   void clearSimValues();
   virtual void clearInstSimValues(const Instance *inst);
   void annotateGraphEdges();
-  void annotateVertexEdges(const Instance *inst,
-			   const Pin *pin,
-			   Vertex *vertex,
-			   bool annotate);
   void annotateVertexEdges(const Instance *inst,
 			   bool annotate);
+  void findEdgeAnnotations(const Instance *inst,
+			   bool annotate,
+			   // Return value.
+			   SimEdgeAnnotationSeq &annotations);
+  void setEdgeAnnotations(const SimEdgeAnnotationSeq &annotations);
   void removePropagatedValue(const Pin *pin);
   void propagateFromInvalidDrvrsToLoads();
   void propagateToInvalidLoads();
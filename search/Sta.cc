@@ -656,10 +656,20 @@ Sta::readLiberty(const char *filename,
 		 Corner *corner,
 		 const MinMaxAll *min_max,
 		 bool infer_latches)
+{
+  return readLiberty(filename, corner, min_max, infer_latches, nullptr);
+}
+
+LibertyLibrary *
+Sta::readLiberty(const char *filename,
+		 Corner *corner,
+		 const MinMaxAll *min_max,
+		 bool infer_latches,
+		 const StringSet *cell_names)
 {
   Stats stats(debug_, report_);
   LibertyLibrary *library = readLibertyFile(filename, corner, min_max,
-                                            infer_latches);
+                                            infer_latches, cell_names);
   if (library
       // The default library is the first library read.
       // This corresponds to a link_path of '*'.
@@ -676,10 +686,11 @@ LibertyLibrary *
 Sta::readLibertyFile(const char *filename,
 		     Corner *corner,
 		     const MinMaxAll *min_max,
-		     bool infer_latches)
+		     bool infer_latches,
+		     const StringSet *cell_names)
 {
   LibertyLibrary *liberty = sta::readLibertyFile(filename, infer_latches,
-						 network_);
+						 cell_names, network_);
   if (liberty) {
     // Don't map liberty cells if they are redefined by reading another
     // library with the same cell names.
@@ -718,7 +729,7 @@ Sta::setMinLibrary(const char *min_filename,
   LibertyLibrary *max_lib = network_->findLibertyFilename(max_filename);
   if (max_lib) {
     LibertyLibrary *min_lib = readLibertyFile(min_filename, cmd_corner_,
-					      MinMaxAll::min(), false);
+					      MinMaxAll::min(), false, nullptr);
     return min_lib != nullptr;
   }
   else
@@ -2204,6 +2215,18 @@ Sta::setCrprMode(CrprMode mode)
   sdc_->setCrprMode(mode);
 }
 
+bool
+Sta::requiredsWorstPerClk() const
+{
+  return search_->requiredsWorstPerClk();
+}
+
+void
+Sta::setRequiredsWorstPerClk(bool enabled)
+{
+  search_->setRequiredsWorstPerClk(enabled);
+}
+
 bool
 Sta::pocvEnabled() const
 {
@@ -2555,7 +2578,9 @@ Sta::setReportPathSigmas(bool report_sigmas)
 void
 Sta::reportPathEnds(PathEndSeq *ends)
 {
+  Stats stats(debug_, report_);
   report_path_->reportPathEnds(ends);
+  stats.report("Report path ends");
 }
 
 void
@@ -2592,10 +2617,12 @@ Sta::reportPath(Path *path)
 void
 Sta::updateTiming(bool full)
 {
+  Stats stats(debug_, report_);
   searchPreamble();
   if (full)
     search_->arrivalsInvalid();
   search_->findAllArrivals();
+  stats.report("Update timing");
 }
 
 ////////////////////////////////////////////////////////////////
@@ -3564,8 +3591,9 @@ Sta::requiredCount() const
   VertexIterator vertex_iter(graph_);
   while (vertex_iter.hasNext()) {
     Vertex *vertex = vertex_iter.next();
-    if (vertex->hasRequireds())
-      count += vertexArrivalCount(vertex);
+    TagGroup *tag_group = search_->tagGroup(vertex);
+    if (tag_group && vertex->hasRequireds())
+      count += tag_group->requiredCount(vertex->sharedRequireds());
   }
   return count;
 }
@@ -3908,10 +3936,12 @@ Sta::readSpef(const char *filename,
     : min_max->asMinMax();
   const Corner *ap_corner = corner ? corner : corners_->corners()[0];
   ParasiticAnalysisPt *ap = ap_corner->findParasiticAnalysisPt(ap_min_max);
+  Stats stats(debug_, report_);
   bool success = readSpefFile(filename, instance, ap,
 			      pin_cap_included, keep_coupling_caps,
                               coupling_cap_factor, reduce,
 			      corner, min_max, this);
+  stats.report("Read spef");
   graph_delay_calc_->delaysInvalid();
   search_->arrivalsInvalid();
   return success;
@@ -16,6 +16,8 @@
 
 #include "TagGroup.hh"
 
+#include <algorithm>
+
 #include "Report.hh"
 #include "Debug.hh"
 #include "Graph.hh"
@@ -23,97 +25,233 @@
 #include "ClkInfo.hh"
 #include "Tag.hh"
 #include "Corner.hh"
+#include "ExceptionPath.hh"
 #include "Search.hh"
 #include "PathVertexRep.hh"
 
 namespace sta {
 
+static bool
+tagRequiredMatch(const Tag *tag1,
+                 const Tag *tag2);
+static bool
+tagSharedRequiredMatch(const Tag *tag1,
+                       const Tag *tag2);
+
 TagGroup::TagGroup(TagGroupIndex index,
-		   ArrivalMap *arrival_map,
+		   Tag **tags,
+		   int tag_count,
+		   bool worst_required_per_clk,
 		   bool has_clk_tag,
 		   bool has_genclk_src_tag,
 		   bool has_filter_tag,
 		   bool has_loop_tag) :
-  arrival_map_(arrival_map),
-  hash_(arrivalMapHash(arrival_map_)),
+  tags_(tags),
+  tag_count_(tag_count),
+  required_indices_(nullptr),
+  required_count_(tag_count),
+  shared_required_indices_(nullptr),
+  shared_required_count_(tag_count),
+  hash_(tagsHash()),
   index_(index),
   has_clk_tag_(has_clk_tag),
   has_genclk_src_tag_(has_genclk_src_tag),
   has_filter_tag_(has_filter_tag),
   has_loop_tag_(has_loop_tag),
-  own_arrival_map_(true)
+  own_tags_(true)
 {
+  if (worst_required_per_clk) {
+    makeRequiredIndices(tagRequiredMatch,
+                        required_indices_, required_count_);
+    makeRequiredIndices(tagSharedRequiredMatch,
+                        shared_required_indices_, shared_required_count_);
+  }
 }
 
-TagGroup::TagGroup(TagGroupBldr *tag_bldr) :
-  arrival_map_(tag_bldr->arrivalMap()),
-  hash_(arrivalMapHash(arrival_map_)),
-  own_arrival_map_(false)
+TagGroup::TagGroup(TagGroupBldr *tag_bldr)
 {
+  const TagSeq &tags = tag_bldr->groupTags();
+  tags_ = const_cast<Tag**>(tags.data());
+  tag_count_ = tags.size();
+  required_indices_ = nullptr;
+  required_count_ = tag_count_;
+  shared_required_indices_ = nullptr;
+  shared_required_count_ = tag_count_;
+  hash_ = tagsHash();
+  own_tags_ = false;
 }
 
 TagGroup::~TagGroup()
 {
-  if (own_arrival_map_)
-    delete arrival_map_;
+  if (own_tags_) {
+    delete [] tags_;
+    delete [] required_indices_;
+    delete [] shared_required_indices_;
+  }
+}
+
+// Tags with the same clock edge, transition, path analysis point and
+// exception states share a required, so they only differ by CRPR clock
+// pin. Tags with different exception states (false path, multicycle
+// -through state) must keep their own requireds because an unconstrained
+// tag would otherwise pick up a constrained required and its slack.
+static bool
+tagRequiredMatch(const Tag *tag1,
+                 const Tag *tag2)
+{
+  const ClkInfo *clk_info1 = tag1->clkInfo();
+  const ClkInfo *clk_info2 = tag2->clkInfo();
+  return tag1->rfIndex() == tag2->rfIndex()
+    && tag1->pathAPIndex() == tag2->pathAPIndex()
+    && clk_info1->clkEdge() == clk_info2->clkEdge()
+    && tag1->isClock() == tag2->isClock()
+    && clk_info1->isGenClkSrcPath() == clk_info2->isGenClkSrcPath()
+    && tag1->isSegmentStart() == tag2->isSegmentStart()
+    && tagStateEqual(tag1, tag2);
+}
+
+static bool
+tagHasFalseState(const Tag *tag)
+{
+  if (tag->isLoop())
+    return true;
+  ExceptionStateSet *states = tag->states();
+  if (states) {
+    for (ExceptionState *state : *states) {
+      const ExceptionPath *exception = state->exception();
+      if (exception->isFalse() || exception->isLoop())
+        return true;
+    }
+  }
+  return false;
+}
+
+// Requireds at vertices that are not endpoints only feed the requireds
+// of their fanin and pin slacks; endpoint slacks (WNS/TNS, path ends)
+// do not use them. Tags with the same clock and path analysis point
+// share the worst required across transitions, clock edges, CRPR clock
+// pins and multicycle/path delay exception states. Tags with false
+// path or loop states keep their states apart so unconstrained paths
+// stay unconstrained.
+static bool
+tagSharedRequiredMatch(const Tag *tag1,
+                       const Tag *tag2)
+{
+  return tag1->pathAPIndex() == tag2->pathAPIndex()
+    && tag1->clock() == tag2->clock()
+    && tag1->isClock() == tag2->isClock()
+    && tag1->isGenClkSrcPath() == tag2->isGenClkSrcPath()
+    && tag1->isSegmentStart() == tag2->isSegmentStart()
+    && tag1->isFilter() == tag2->isFilter()
+    && ((!tagHasFalseState(tag1) && !tagHasFalseState(tag2))
+        || tagStateEqual(tag1, tag2));
+}
+
+void
+TagGroup::makeRequiredIndices(bool (*match)(const Tag *tag1,
+                                            const Tag *tag2),
+                              // Return values.
+                              int *&required_indices,
+                              uint32_t &required_count)
+{
+  // tagMatchCmp does not sort tags that share a required next to each
+  // other. Tag groups are small, so search the tags that start a
+  // required.
+  TagSeq required_tags;
+  int *indices = new int[tag_count_];
+  for (uint32_t i = 0; i < tag_count_; i++) {
+    Tag *tag = tags_[i];
+    int required_index = -1;
+    for (size_t j = 0; j < required_tags.size(); j++) {
+      if (match(required_tags[j], tag)) {
+        required_index = j;
+        break;
+      }
+    }
+    if (required_index == -1) {
+      required_index = required_tags.size();
+      required_tags.push_back(tag);
+    }
+    indices[i] = required_index;
+  }
+  if (required_tags.size() < tag_count_) {
+    required_indices = indices;
+    required_count = required_tags.size();
+  }
+  else
+    delete [] indices;
 }
 
 size_t
-TagGroup::arrivalMapHash(ArrivalMap *arrival_map)
+TagGroup::tagsHash() const
 {
   size_t hash = 0;
-  ArrivalMap::Iterator arrival_iter(arrival_map);
-  while (arrival_iter.hasNext()) {
-    Tag *tag;
-    int arrival_index;
-    arrival_iter.next(tag, arrival_index);
-    hash += tag->hash();
-  }
+  for (uint32_t i = 0; i < tag_count_; i++)
+    hash += tags_[i]->hash();
   return hash;
 }
 
 bool
-TagGroup::hasTag(Tag *tag) const
+TagGroup::hasTag(Tag *tag,
+		 const StaState *sta) const
 {
-  return arrival_map_->hasKey(tag);
+  int arrival_index;
+  bool exists;
+  arrivalIndex(tag, sta, arrival_index, exists);
+  return exists;
 }
 
 void
 TagGroup::arrivalIndex(Tag *tag,
+		       const StaState *sta,
+		       // Return values.
 		       int &arrival_index,
 		       bool &exists) const
 {
-  arrival_map_->findKey(tag, arrival_index, exists);
+  arrival_index = -1;
+  exists = false;
+  if (tag_count_ > 0) {
+    // Binary search that only moves the base of the range so the
+    // compiler can use a conditional move instead of a branch.
+    Tag **base = tags_;
+    uint32_t count = tag_count_;
+    while (count > 1) {
+      uint32_t half = count / 2;
+      base += (tagMatchCmp(base[half], tag, true, sta) <= 0) ? half : 0;
+      count -= half;
+    }
+    if (*base == tag
+	|| tagMatchCmp(*base, tag, true, sta) == 0) {
+      arrival_index = base - tags_;
+      exists = true;
+    }
+  }
 }
 
-void
-TagGroup::report(const StaState *sta) const
+bool
+TagGroup::tagsEqual(const TagGroup *tag_group) const
 {
-  Report *report = sta->report();
-  report->reportLine("Group %u hash = %lu", index_, hash_);
-  arrivalMapReport(arrival_map_, sta);
+  // Tags are sorted, so groups with the same tags have the same order.
+  return tag_count_ == tag_group->tag_count_
+    && std::equal(tags_, tags_ + tag_count_, tag_group->tags_);
 }
 
 void
-TagGroup::reportArrivalMap(const StaState *sta) const
+TagGroup::report(const StaState *sta) const
 {
-  arrivalMapReport(arrival_map_, sta);
+  Report *report = sta->report();
+  report->reportLine("Group %u hash = %lu", index_, hash_);
+  reportArrivalEntries(sta);
 }
 
 void
-arrivalMapReport(const ArrivalMap *arrival_map,
-		 const StaState *sta)
+TagGroup::reportArrivalEntries(const StaState *sta) const
 {
   Report *report = sta->report();
-  ArrivalMap::ConstIterator arrival_iter(arrival_map);
-  while (arrival_iter.hasNext()) {
-    Tag *tag;
-    int arrival_index;
-    arrival_iter.next(tag, arrival_index);
+  for (uint32_t arrival_index = 0; arrival_index < tag_count_; arrival_index++)
     report->reportLine(" %2u %s",
                        arrival_index,
-                       tag->asString(sta));
-  }
+                       tags_[arrival_index]->asString(sta));
   report->reportBlankLine();
 }
 
@@ -124,32 +262,35 @@ TagGroupBldr::TagGroupBldr(bool match_crpr_clk_pin,
   default_arrival_count_(sta->corners()->count()
 			 * RiseFall::index_count
 			 * MinMax::index_count),
-  arrival_map_(default_arrival_count_,
-	       TagMatchHash(match_crpr_clk_pin, sta),
-	       TagMatchEqual(match_crpr_clk_pin, sta)),
-  arrivals_(default_arrival_count_),
-  prev_paths_(default_arrival_count_),
+  match_crpr_clk_pin_(match_crpr_clk_pin),
+  group_tags_valid_(false),
   has_clk_tag_(false),
   has_genclk_src_tag_(false),
   has_filter_tag_(false),
   has_loop_tag_(false),
   sta_(sta)
 {
+  tag_arrivals_.reserve(default_arrival_count_);
+  arrivals_.reserve(default_arrival_count_);
+  prev_paths_.reserve(default_arrival_count_);
+  group_tags_.reserve(default_arrival_count_);
+  group_arrival_indices_.reserve(default_arrival_count_);
 }
 
 bool
 TagGroupBldr::empty()
 {
-  return arrival_map_.empty();
+  return tag_arrivals_.empty();
 }
 
 void
 TagGroupBldr::init(Vertex *vertex)
 {
   vertex_ = vertex;
-  arrival_map_.clear();
+  tag_arrivals_.clear();
   arrivals_.clear();
   prev_paths_.clear();
+  group_tags_valid_ = false;
   has_clk_tag_ = false;
   has_genclk_src_tag_ = false;
   has_filter_tag_ = false;
@@ -159,7 +300,31 @@ TagGroupBldr::init(Vertex *vertex)
 void
 TagGroupBldr::reportArrivalEntries() const
 {
-  arrivalMapReport(&arrival_map_, sta_);
+  Report *report = sta_->report();
+  for (const TagArrival &tag_arrival : tag_arrivals_)
+    report->reportLine(" %2d %s",
+                       tag_arrival.arrival_index,
+                       tag_arrival.tag->asString(sta_));
+  report->reportBlankLine();
+}
+
+// First entry that does not compare less than tag.
+TagArrivalSeq::const_iterator
+TagGroupBldr::findTagArrival(const Tag *tag) const
+{
+  return std::lower_bound(tag_arrivals_.begin(), tag_arrivals_.end(), tag,
+                          [this] (const TagArrival &tag_arrival,
+                                  const Tag *tag) {
+                            return tagMatchCmp(tag_arrival.tag, tag,
+                                               match_crpr_clk_pin_, sta_) < 0;
+                          });
+}
+
+TagArrivalSeq::iterator
+TagGroupBldr::findTagArrival(const Tag *tag)
+{
+  auto const_itr = const_cast<const TagGroupBldr*>(this)->findTagArrival(tag);
+  return tag_arrivals_.begin() + (const_itr - tag_arrivals_.cbegin());
 }
 
 void
@@ -172,10 +337,13 @@ TagGroupBldr::tagMatchArrival(Tag *tag,
   // Find matching group tag.
   // Match is not necessarily equal to original tag because it
   // must only satisfy tagMatch.
-  bool exists;
-  arrival_map_.findKey(tag, tag_match, arrival_index, exists);
-  if (exists)
+  auto itr = findTagArrival(tag);
+  if (itr != tag_arrivals_.end()
+      && tagMatchCmp(itr->tag, tag, match_crpr_clk_pin_, sta_) == 0) {
+    tag_match = itr->tag;
+    arrival_index = itr->arrival_index;
     arrival = arrivals_[arrival_index];
+  }
   else {
     tag_match = nullptr;
     arrival = -1.0;
@@ -210,18 +378,21 @@ TagGroupBldr::setMatchArrival(Tag *tag,
 			      PathVertexRep *prev_path)
 {
   if (tag_match) {
-    // If the group_tag exists there has to be an arrival map entry for it.
+    // If the group_tag exists there has to be an arrival entry for it.
     if (tag_match != tag) {
-      // Replace tag in arrival map.
-      arrival_map_.erase(tag_match);
-      arrival_map_.insert(tag, arrival_index);
+      // Replace tag in place; matching tags sort to the same position.
+      auto itr = findTagArrival(tag_match);
+      itr->tag = tag;
+      group_tags_valid_ = false;
     }
     arrivals_[arrival_index] = arrival;
     prev_paths_[arrival_index].init(prev_path);
   }
   else {
     arrival_index = arrivals_.size();
-    arrival_map_.insert(tag, arrival_index);
+    auto itr = findTagArrival(tag);
+    tag_arrivals_.insert(itr, TagArrival{tag, arrival_index});
+    group_tags_valid_ = false;
     arrivals_.push_back(arrival);
     if (prev_path)
       prev_paths_.push_back(*prev_path);
@@ -243,35 +414,66 @@ TagGroupBldr::setMatchArrival(Tag *tag,
 void
 TagGroupBldr::deleteArrival(Tag *tag)
 {
-  arrival_map_.erase(tag);
+  auto itr = findTagArrival(tag);
+  if (itr != tag_arrivals_.end()
+      && tagMatchCmp(itr->tag, tag, match_crpr_clk_pin_, sta_) == 0) {
+    tag_arrivals_.erase(itr);
+    group_tags_valid_ = false;
+  }
+}
+
+const TagSeq &
+TagGroupBldr::groupTags()
+{
+  if (!group_tags_valid_)
+    sortGroupTags();
+  return group_tags_;
+}
+
+void
+TagGroupBldr::sortGroupTags()
+{
+  size_t tag_count = tag_arrivals_.size();
+  if (match_crpr_clk_pin_) {
+    // Already in group order.
+    group_tags_.resize(tag_count);
+    group_arrival_indices_.resize(tag_count);
+    for (size_t i = 0; i < tag_count; i++) {
+      group_tags_[i] = tag_arrivals_[i].tag;
+      group_arrival_indices_[i] = tag_arrivals_[i].arrival_index;
+    }
+  }
+  else {
+    // Matching without the crpr clk pin sorts differently so sort a copy.
+    TagArrivalSeq sorted(tag_arrivals_);
+    std::sort(sorted.begin(), sorted.end(),
+         [this] (const TagArrival &tag_arrival1,
+                 const TagArrival &tag_arrival2) {
+           return tagMatchCmp(tag_arrival1.tag, tag_arrival2.tag,
+                              true, sta_) < 0;
+         });
+    group_tags_.resize(tag_count);
+    group_arrival_indices_.resize(tag_count);
+    for (size_t i = 0; i < tag_count; i++) {
+      group_tags_[i] = sorted[i].tag;
+      group_arrival_indices_[i] = sorted[i].arrival_index;
+    }
+  }
+  group_tags_valid_ = true;
 }
 
 TagGroup *
 TagGroupBldr::makeTagGroup(TagGroupIndex index,
 			   const StaState *sta)
 {
-  return new TagGroup(index, makeArrivalMap(sta),
+  const TagSeq &group_tags = groupTags();
+  size_t tag_count = group_tags.size();
+  Tag **tags = new Tag*[tag_count];
+  std::copy(group_tags.begin(), group_tags.end(), tags);
+  return new TagGroup(index, tags, tag_count,
+		      sta->search()->requiredsWorstPerClk(),
 		      has_clk_tag_, has_genclk_src_tag_, has_filter_tag_,
 		      has_loop_tag_);
-
-}
-
-ArrivalMap *
-TagGroupBldr::makeArrivalMap(const StaState *sta)
-{
-  ArrivalMap *arrival_map = new ArrivalMap(arrival_map_.size(),
-					   TagMatchHash(true, sta),
-					   TagMatchEqual(true, sta));
-  int arrival_index = 0;
-  ArrivalMap::Iterator arrival_iter(arrival_map_);
-  while (arrival_iter.hasNext()) {
-    Tag *tag;
-    int arrival_index1;
-    arrival_iter.next(tag, arrival_index1);
-    arrival_map->insert(tag, arrival_index);
-    arrival_index++;
-  }
-  return arrival_map;
 }
 
 void
@@ -279,22 +481,21 @@ TagGroupBldr::copyArrivals(TagGroup *tag_group,
 			   Arrival *arrivals,
 			   PathVertexRep *prev_paths)
 {
-  ArrivalMap::Iterator arrival_iter1(arrival_map_);
-  while (arrival_iter1.hasNext()) {
-    Tag *tag1;
-    int arrival_index1, arrival_index2;
-    arrival_iter1.next(tag1, arrival_index1);
-    bool exists2;
-    tag_group->arrivalIndex(tag1, arrival_index2, exists2);
-    if (exists2) {
-      arrivals[arrival_index2] = arrivals_[arrival_index1];
-      if (prev_paths) {
-	PathVertexRep *prev_path = &prev_paths_[arrival_index1];
-	prev_paths[arrival_index2].init(prev_path);
-      }
+  // The tag group was found with a probe of the group tags, so the
+  // arrival indices are the group tag positions.
+  const TagSeq &group_tags = groupTags();
+  size_t tag_count = group_tags.size();
+  if (static_cast<size_t>(tag_group->arrivalCount()) != tag_count
+      || !std::equal(group_tags.begin(), group_tags.end(),
+                     tag_group->tags()))
+    sta_->report()->critical(1351, "tag group missing tag");
+  for (size_t arrival_index2 = 0; arrival_index2 < tag_count; arrival_index2++) {
+    int arrival_index1 = group_arrival_indices_[arrival_index2];
+    arrivals[arrival_index2] = arrivals_[arrival_index1];
+    if (prev_paths) {
+      PathVertexRep *prev_path = &prev_paths_[arrival_index1];
+      prev_paths[arrival_index2].init(prev_path);
     }
-    else
-      sta_->report()->critical(1351, "tag group missing tag");
   }
 }
 
@@ -306,40 +507,13 @@ TagGroupHash::operator()(const TagGroup *group) const
   return group->hash();
 }
 
-static bool
-arrivalMapEqual(const ArrivalMap *arrival_map1,
-		const ArrivalMap *arrival_map2)
-{
-  int arrival_count1 = arrival_map1->size();
-  int arrival_count2 = arrival_map2->size();
-  if (arrival_count1 == arrival_count2) {
-    ArrivalMap::ConstIterator arrival_iter1(arrival_map1);
-    while (arrival_iter1.hasNext()) {
-      Tag *tag1, *tag2;
-      int arrival_index1, arrival_index2;
-      arrival_iter1.next(tag1, arrival_index1);
-      bool exists2;
-      arrival_map2->findKey(tag1, tag2, arrival_index2, exists2);
-      if (!exists2 
-	  // ArrivalMap equal function is TagMatchEqual, so make sure
-	  // the tag is an exact match.
-	  || tag2 != tag1)
-	return false;
-    }
-    return true;
-  }
-  else
-    return false;
-}
-
 bool
 TagGroupEqual::operator()(const TagGroup *tag_group1,
 			  const TagGroup *tag_group2) const
 {
   return tag_group1 == tag_group2
     || (tag_group1->hash() == tag_group2->hash()
-	&& arrivalMapEqual(tag_group1->arrivalMap(),
-			   tag_group2->arrivalMap()));
+	&& tag_group1->tagsEqual(tag_group2));
 }
 
 } // namespace
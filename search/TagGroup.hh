@@ -16,8 +16,9 @@
 
 #pragma once
 
+#include <vector>
+
 #include "Vector.hh"
-#include "Map.hh"
 #include "Iterator.hh"
 #include "MinMax.hh"
 #include "Transition.hh"
@@ -34,8 +35,11 @@ typedef Vector<PathVertexRep> PathVertexRepSeq;
 class TagGroup
 {
 public:
+  // Takes ownership of tags, which must be sorted by tagMatchCmp.
   TagGroup(TagGroupIndex index,
-	   ArrivalMap *arrival_map,
+	   Tag **tags,
+	   int tag_count,
+	   bool worst_required_per_clk,
 	   bool has_clk_tag,
 	   bool has_genclk_src_tag,
 	   bool has_filter_tag,
@@ -46,33 +50,75 @@ public:
   TagGroupIndex index() const { return index_; }
   size_t hash() const { return hash_; }
   void report(const StaState *sta) const;
-  void reportArrivalMap(const StaState *sta) const;
+  void reportArrivalEntries(const StaState *sta) const;
   bool hasClkTag() const { return has_clk_tag_; }
   bool hasGenClkSrcTag() const { return has_genclk_src_tag_; }
   bool hasFilterTag() const { return has_filter_tag_; }
   bool hasLoopTag() const { return has_loop_tag_; }
-  bool ownArrivalMap() const { return own_arrival_map_; }
-  int arrivalCount() const { return arrival_map_->size(); }
+  int arrivalCount() const { return tag_count_; }
+  // Tag of the arrival at arrival_index.
+  Tag *arrivalTag(int arrival_index) const { return tags_[arrival_index]; }
+  Tag * const *tags() const { return tags_; }
+  // Number of required times stored for each vertex with this group.
+  // With sta_requireds_worst_per_clk, endpoint requireds are only shared
+  // by tags that differ by CRPR clock pin, and shared requireds (at
+  // vertices that are not endpoints) are shared by all tags with the
+  // same clock and path analysis point.
+  int requiredCount(bool shared) const;
+  int requiredIndex(int arrival_index,
+                    bool shared) const;
   void arrivalIndex(Tag *tag,
+		    const StaState *sta,
+		    // Return values.
 		    int &arrival_index,
 		    bool &exists) const;
-  ArrivalMap *arrivalMap() const { return arrival_map_; }
-  bool hasTag(Tag *tag) const;
+  bool hasTag(Tag *tag,
+	      const StaState *sta) const;
+  bool tagsEqual(const TagGroup *tag_group) const;
 
 protected:
-  size_t arrivalMapHash(ArrivalMap *arrival_map);
+  size_t tagsHash() const;
+  void makeRequiredIndices(bool (*match)(const Tag *tag1,
+                                          const Tag *tag2),
+                           // Return values.
+                           int *&required_indices,
+                           uint32_t &required_count);
 
-  // tag -> arrival index
-  ArrivalMap *arrival_map_;
+  // Tags sorted by tagMatchCmp so they can be binary searched.
+  // The position of a tag is the index of its arrival.
+  Tag **tags_;
+  uint32_t tag_count_;
+  // Arrival index -> required index when arrivals share requireds.
+  // nullptr when there is one required per arrival.
+  int *required_indices_;
+  uint32_t required_count_;
+  int *shared_required_indices_;
+  uint32_t shared_required_count_;
   size_t hash_;
   unsigned int index_:tag_group_index_bits;
   bool has_clk_tag_:1;
   bool has_genclk_src_tag_:1;
   bool has_filter_tag_:1;
   bool has_loop_tag_:1;
-  bool own_arrival_map_:1;
+  bool own_tags_:1;
 };
 
+inline int
+TagGroup::requiredCount(bool shared) const
+{
+  return shared ? shared_required_count_ : required_count_;
+}
+
+inline int
+TagGroup::requiredIndex(int arrival_index,
+                        bool shared) const
+{
+  int *required_indices = shared
+    ? shared_required_indices_
+    : required_indices_;
+  return required_indices ? required_indices[arrival_index] : arrival_index;
+}
+
 class TagGroupHash
 {
 public:
@@ -86,8 +132,19 @@ public:
 		  const TagGroup *group2) const;
 };
 
+// Tag and the index of its arrival in TagGroupBldr.
+struct TagArrival
+{
+  Tag *tag;
+  int arrival_index;
+};
+
+typedef std::vector<TagArrival> TagArrivalSeq;
+
 // Incremental tag group used to build tag group and associated
 // arrivals.
+// The builders are per thread and reused for every vertex, so the
+// tag arrays are cleared but never freed between vertices.
 class TagGroupBldr
 {
 public:
@@ -117,20 +174,30 @@ public:
 		       const Arrival &arrival,
 		       int arrival_index,
 		       PathVertexRep *prev_path);
-  ArrivalMap *arrivalMap() { return &arrival_map_; }
+  // Tags sorted by tagMatchCmp(match_crpr_clk_pin).
+  const TagArrivalSeq &tagArrivals() const { return tag_arrivals_; }
+  // Tags in TagGroup order.
+  const TagSeq &groupTags();
   void copyArrivals(TagGroup *tag_group,
 		    Arrival *arrivals,
 		    PathVertexRep *prev_paths);
 
 protected:
-  int tagMatchIndex();
-  ArrivalMap *makeArrivalMap(const StaState *sta);
+  TagArrivalSeq::const_iterator findTagArrival(const Tag *tag) const;
+  TagArrivalSeq::iterator findTagArrival(const Tag *tag);
+  void sortGroupTags();
 
   Vertex *vertex_;
   int default_arrival_count_;
-  ArrivalMap arrival_map_;
+  bool match_crpr_clk_pin_;
+  TagArrivalSeq tag_arrivals_;
   ArrivalSeq arrivals_;
   PathVertexRepSeq prev_paths_;
+  // Scratch for TagGroup probes sorted by tagMatchCmp with the crpr
+  // clk pin and the indices of their arrivals.
+  TagSeq group_tags_;
+  std::vector<int> group_arrival_indices_;
+  bool group_tags_valid_;
   bool has_clk_tag_;
   bool has_genclk_src_tag_:1;
   bool has_filter_tag_;
@@ -138,8 +205,4 @@ protected:
   const StaState *sta_;
 };
 
-void
-arrivalMapReport(const ArrivalMap *arrival_map,
-		 const StaState *sta);
-
 } // namespace
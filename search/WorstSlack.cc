@@ -16,6 +16,9 @@
 
 #include "WorstSlack.hh"
 
+#include <algorithm>
+#include <utility>
+
 #include "Debug.hh"
 #include "Report.hh"
 #include "Mutex.hh"
@@ -28,6 +31,9 @@ namespace sta {
 
 using std::min;
 
+typedef std::pair<Vertex*, Slack> VertexSlack;
+typedef Vector<VertexSlack> VertexSlackSeq;
+
 WorstSlacks::WorstSlacks(StaState *sta) :
   worst_slacks_(sta->corners()->pathAnalysisPtCount(), sta),
   sta_(sta)
@@ -159,8 +165,14 @@ WorstSlack::initQueue(PathAPIndex path_ap_index)
   worst_vertex_ = nullptr;
   worst_slack_ = slack_init_;
   slack_threshold_ = slack_init_;
-  for(Vertex *vertex : *search_->endpoints()) {
-    Slack slack = search_->wnsSlack(vertex, path_ap_index);
+  VertexSeq ends;
+  for (Vertex *vertex : *search_->endpoints())
+    ends.push_back(vertex);
+  SlackSeq slacks;
+  search_->wnsSlacks(ends, path_ap_index, slacks);
+  for (size_t i = 0; i < ends.size(); i++) {
+    Vertex *vertex = ends[i];
+    Slack slack = slacks[i];
     if (!delayEqual(slack, slack_init_)) {
       if (delayLess(slack, worst_slack_, this))
 	setWorstSlack(vertex, slack);
@@ -182,34 +194,33 @@ WorstSlack::sortQueue(PathAPIndex path_ap_index)
   if (queue_->size() > 0) {
     debugPrint(debug_, "wns", 3, "sort queue");
 
-    VertexSeq vertices;
-    vertices.reserve(queue_->size());
+    // Find each slack once instead of in every comparison.
+    VertexSlackSeq vertex_slacks;
+    vertex_slacks.reserve(queue_->size());
     for (Vertex *vertex : *queue_)
-      vertices.push_back(vertex);
-    WnsSlackLess slack_less(path_ap_index, this);
-    sort(vertices, slack_less);
-
-    int vertex_count = vertices.size();
+      vertex_slacks.push_back(VertexSlack(vertex, search_->wnsSlack(vertex, path_ap_index)));
+    std::stable_sort(vertex_slacks.begin(), vertex_slacks.end(),
+                     [this] (const VertexSlack &vertex_slack1,
+                             const VertexSlack &vertex_slack2) {
+                       return delayLess(vertex_slack1.second,
+                                        vertex_slack2.second, this);
+                     });
+
+    int vertex_count = vertex_slacks.size();
     int threshold_index = min(min_queue_size_, vertex_count - 1);
-    Vertex *threshold_vertex = vertices[threshold_index];
-    slack_threshold_ = search_->wnsSlack(threshold_vertex, path_ap_index);
+    slack_threshold_ = vertex_slacks[threshold_index].second;
     debugPrint(debug_, "wns", 3, "threshold %s",
                delayAsString(slack_threshold_, this));
 
     // Reinsert vertices with slack < threshold.
     queue_->clear();
-    VertexSeq::Iterator queue_iter2(vertices);
-    while (queue_iter2.hasNext()) {
-      Vertex *vertex = queue_iter2.next();
-      Slack slack = search_->wnsSlack(vertex, path_ap_index);
-      if (delayGreater(slack, slack_threshold_, this))
+    for (const VertexSlack &vertex_slack : vertex_slacks) {
+      if (delayGreater(vertex_slack.second, slack_threshold_, this))
 	break;
-      queue_->insert(vertex);
+      queue_->insert(vertex_slack.first);
     }
     max_queue_size_ = queue_->size() * 2;
-    Vertex *worst_slack_vertex = vertices[0];
-    Slack worst_slack_slack = search_->wnsSlack(worst_slack_vertex, path_ap_index);
-    setWorstSlack(worst_slack_vertex, worst_slack_slack);
+    setWorstSlack(vertex_slacks[0].first, vertex_slacks[0].second);
   }
 }
 
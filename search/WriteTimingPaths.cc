@@ -0,0 +1,429 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2024, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include "WriteTimingPaths.hh"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Error.hh"
+#include "DispatchQueue.hh"
+#include "UnorderedMap.hh"
+#include "TimingRole.hh"
+#include "TimingArc.hh"
+#include "Network.hh"
+#include "Graph.hh"
+#include "Clock.hh"
+#include "Corner.hh"
+#include "DcalcAnalysisPt.hh"
+#include "GraphDelayCalc.hh"
+#include "PathAnalysisPt.hh"
+#include "PathRef.hh"
+#include "PathExpanded.hh"
+#include "PathEnd.hh"
+#include "PathGroup.hh"
+#include "Search.hh"
+#include "StaState.hh"
+
+namespace sta {
+
+using std::string;
+using std::vector;
+
+static const char timing_paths_magic[] = "STAPATH1";
+static const size_t timing_paths_magic_length = 8;
+static const uint32_t string_index_none = UINT32_MAX;
+static const uint8_t rf_index_none = 2;
+static const uint8_t point_flag_clock = 1;
+static const uint8_t point_flag_driver = 2;
+// Path ends expanded in parallel before they are appended to the
+// columns, to bound the memory used by the expanded paths.
+static const size_t path_batch_size = 4096;
+
+// Path point found by the expansion threads.
+class TimingPathPoint
+{
+public:
+  const Pin *pin;
+  const TimingArc *prev_arc;
+  float arrival;
+  float slew;
+  uint8_t rf_index;
+  uint8_t flags;
+};
+
+// Path end values found by the expansion threads.
+class TimingPath
+{
+public:
+  const ClockEdge *src_clk_edge;
+  const ClockEdge *tgt_clk_edge;
+  float src_clk_offset;
+  float data_arrival;
+  float required;
+  float slack;
+  float margin;
+  float tgt_clk_time;
+  float crpr;
+  vector<TimingPathPoint> points;
+};
+
+typedef UnorderedMap<const void*, uint32_t> StringIndexMap;
+
+class TimingPathsWriter : public StaState
+{
+public:
+  TimingPathsWriter(StaState *sta);
+  void write(PathEndSeq *ends,
+             const char *filename);
+
+protected:
+  void expandPaths(PathEndSeq *ends,
+                   size_t begin,
+                   size_t end);
+  void expandPath(PathEnd *path_end,
+                  TimingPath &path);
+  void appendPaths(PathEndSeq *ends,
+                   size_t begin,
+                   size_t end);
+  void appendPath(PathEnd *path_end,
+                  const TimingPath &path);
+  uint32_t stringIndex(const void *key,
+                       const char *str);
+  uint32_t pinIndex(const Pin *pin);
+  uint32_t clkIndex(const ClockEdge *clk_edge);
+  uint8_t clkRfIndex(const ClockEdge *clk_edge);
+  template <class TYPE>
+  void writeColumn(const vector<TYPE> &column);
+  void writeUint32(uint32_t value);
+  void writeBytes(const void *buffer,
+                  size_t size);
+
+  const char *filename_;
+  FILE *stream_;
+  vector<TimingPath> batch_;
+  StringIndexMap string_index_map_;
+  vector<string> strings_;
+  // Path columns.
+  vector<uint32_t> path_first_points_;
+  vector<uint32_t> path_types_;
+  vector<uint32_t> path_groups_;
+  vector<uint32_t> path_corners_;
+  vector<uint8_t> path_min_maxs_;
+  vector<uint8_t> path_end_rfs_;
+  vector<uint32_t> path_src_clks_;
+  vector<uint8_t> path_src_clk_rfs_;
+  vector<uint32_t> path_tgt_clks_;
+  vector<uint8_t> path_tgt_clk_rfs_;
+  vector<float> path_src_clk_offsets_;
+  vector<float> path_data_arrivals_;
+  vector<float> path_requireds_;
+  vector<float> path_slacks_;
+  vector<float> path_margins_;
+  vector<float> path_tgt_clk_times_;
+  vector<float> path_crprs_;
+  // Point columns.
+  vector<uint32_t> point_pins_;
+  vector<uint32_t> point_roles_;
+  vector<uint8_t> point_rfs_;
+  vector<uint8_t> point_flags_;
+  vector<float> point_arrivals_;
+  vector<float> point_incrs_;
+  vector<float> point_slews_;
+  vector<float> point_caps_;
+};
+
+void
+writeTimingPaths(PathEndSeq *ends,
+                 const char *filename,
+                 StaState *sta)
+{
+  TimingPathsWriter writer(sta);
+  writer.write(ends, filename);
+}
+
+TimingPathsWriter::TimingPathsWriter(StaState *sta) :
+  StaState(sta),
+  filename_(nullptr),
+  stream_(nullptr)
+{
+}
+
+void
+TimingPathsWriter::write(PathEndSeq *ends,
+                         const char *filename)
+{
+  filename_ = filename;
+  stream_ = fopen(filename, "wb");
+  if (stream_ == nullptr)
+    throw FileNotWritable(filename);
+  size_t end_count = ends ? ends->size() : 0;
+  for (size_t begin = 0; begin < end_count; begin += path_batch_size) {
+    size_t end = std::min(begin + path_batch_size, end_count);
+    expandPaths(ends, begin, end);
+    appendPaths(ends, begin, end);
+  }
+
+  writeBytes(timing_paths_magic, timing_paths_magic_length);
+  writeUint32(path_first_points_.size());
+  writeUint32(point_pins_.size());
+  writeUint32(strings_.size());
+  for (const string &str : strings_) {
+    writeUint32(str.size());
+    writeBytes(str.data(), str.size());
+  }
+  writeColumn(path_first_points_);
+  writeColumn(path_types_);
+  writeColumn(path_groups_);
+  writeColumn(path_corners_);
+  writeColumn(path_min_maxs_);
+  writeColumn(path_end_rfs_);
+  writeColumn(path_src_clks_);
+  writeColumn(path_src_clk_rfs_);
+  writeColumn(path_tgt_clks_);
+  writeColumn(path_tgt_clk_rfs_);
+  writeColumn(path_src_clk_offsets_);
+  writeColumn(path_data_arrivals_);
+  writeColumn(path_requireds_);
+  writeColumn(path_slacks_);
+  writeColumn(path_margins_);
+  writeColumn(path_tgt_clk_times_);
+  writeColumn(path_crprs_);
+  writeColumn(point_pins_);
+  writeColumn(point_roles_);
+  writeColumn(point_rfs_);
+  writeColumn(point_flags_);
+  writeColumn(point_arrivals_);
+  writeColumn(point_incrs_);
+  writeColumn(point_slews_);
+  writeColumn(point_caps_);
+  // Buffered write errors show up when the stream is flushed.
+  int status = fclose(stream_);
+  stream_ = nullptr;
+  if (status != 0)
+    throw FileNotWritable(filename);
+}
+
+// Path expansion and the path end values are independent for each
+// path end so they are found in parallel.
+void
+TimingPathsWriter::expandPaths(PathEndSeq *ends,
+                               size_t begin,
+                               size_t end)
+{
+  size_t path_count = end - begin;
+  batch_.resize(path_count);
+  size_t thread_count = thread_count_;
+  if (thread_count == 1 || path_count < thread_count) {
+    for (size_t i = 0; i < path_count; i++)
+      expandPath((*ends)[begin + i], batch_[i]);
+  }
+  else {
+    size_t from = 0;
+    size_t chunk_size = path_count / thread_count;
+    for (size_t k = 0; k < thread_count; k++) {
+      // Last thread gets the left overs.
+      size_t to = (k == thread_count - 1) ? path_count : from + chunk_size;
+      dispatch_queue_->dispatch([=](int) {
+        for (size_t i = from; i < to; i++)
+          expandPath((*ends)[begin + i], batch_[i]);
+      });
+      from = to;
+    }
+    dispatch_queue_->finishTasks();
+  }
+}
+
+void
+TimingPathsWriter::expandPath(PathEnd *path_end,
+                              TimingPath &path)
+{
+  path.src_clk_edge = path_end->sourceClkEdge(this);
+  path.tgt_clk_edge = path_end->targetClkEdge(this);
+  path.src_clk_offset = path_end->sourceClkOffset(this);
+  path.data_arrival = delayAsFloat(path_end->dataArrivalTime(this));
+  path.required = delayAsFloat(path_end->requiredTime(this));
+  path.slack = delayAsFloat(path_end->slack(this));
+  path.margin = delayAsFloat(path_end->margin(this));
+  path.tgt_clk_time = path_end->targetClkTime(this);
+  path.crpr = delayAsFloat(path_end->commonClkPessimism(this));
+
+  PathExpanded expanded(path_end->path(), this);
+  DcalcAPIndex ap_index = path_end->pathAnalysisPt(this)->dcalcAnalysisPt()->index();
+  size_t point_count = expanded.size();
+  path.points.resize(point_count);
+  for (size_t i = 0; i < point_count; i++) {
+    const PathRef *path1 = expanded.path(i);
+    Vertex *vertex = path1->vertex(this);
+    const RiseFall *rf = path1->transition(this);
+    TimingPathPoint &point = path.points[i];
+    point.pin = vertex->pin();
+    point.prev_arc = expanded.prevArc(i);
+    point.arrival = delayAsFloat(path1->arrival(this));
+    point.slew = delayAsFloat(graph_->slew(vertex, rf, ap_index));
+    point.rf_index = rf->index();
+    point.flags = 0;
+    if (path1->isClock(search_))
+      point.flags |= point_flag_clock;
+    if (network_->isDriver(point.pin))
+      point.flags |= point_flag_driver;
+  }
+}
+
+// Names and load capacitances use caches that are not thread safe so
+// the expanded paths are appended to the columns serially.
+void
+TimingPathsWriter::appendPaths(PathEndSeq *ends,
+                               size_t begin,
+                               size_t end)
+{
+  for (size_t i = begin; i < end; i++)
+    appendPath((*ends)[i], batch_[i - begin]);
+}
+
+void
+TimingPathsWriter::appendPath(PathEnd *path_end,
+                              const TimingPath &path)
+{
+  PathAnalysisPt *path_ap = path_end->pathAnalysisPt(this);
+  const DcalcAnalysisPt *dcalc_ap = path_ap->dcalcAnalysisPt();
+  const Corner *corner = path_ap->corner();
+  PathGroup *group = search_->pathGroup(path_end);
+  const char *type_name = path_end->typeName();
+
+  path_first_points_.push_back(point_pins_.size());
+  path_types_.push_back(stringIndex(type_name, type_name));
+  path_groups_.push_back(group
+                         ? stringIndex(group, group->name())
+                         : string_index_none);
+  path_corners_.push_back(stringIndex(corner, corner->name()));
+  path_min_maxs_.push_back(path_end->minMax(this)->index());
+  path_end_rfs_.push_back(path_end->transition(this)->index());
+  path_src_clks_.push_back(clkIndex(path.src_clk_edge));
+  path_src_clk_rfs_.push_back(clkRfIndex(path.src_clk_edge));
+  path_tgt_clks_.push_back(clkIndex(path.tgt_clk_edge));
+  path_tgt_clk_rfs_.push_back(clkRfIndex(path.tgt_clk_edge));
+  path_src_clk_offsets_.push_back(path.src_clk_offset);
+  path_data_arrivals_.push_back(path.data_arrival);
+  path_requireds_.push_back(path.required);
+  path_slacks_.push_back(path.slack);
+  path_margins_.push_back(path.margin);
+  path_tgt_clk_times_.push_back(path.tgt_clk_time);
+  path_crprs_.push_back(path.crpr);
+
+  float prev_arrival = 0.0;
+  for (const TimingPathPoint &point : path.points) {
+    const TimingArc *prev_arc = point.prev_arc;
+    point_pins_.push_back(pinIndex(point.pin));
+    if (prev_arc) {
+      const TimingRole *role = prev_arc->role();
+      point_roles_.push_back(stringIndex(role, role->asString()));
+    }
+    else
+      point_roles_.push_back(string_index_none);
+    point_rfs_.push_back(point.rf_index);
+    point_flags_.push_back(point.flags);
+    point_arrivals_.push_back(point.arrival);
+    point_incrs_.push_back(prev_arc ? point.arrival - prev_arrival : 0.0);
+    point_slews_.push_back(point.slew);
+    float cap = 0.0;
+    if (point.flags & point_flag_driver)
+      cap = graph_delay_calc_->loadCap(point.pin,
+                                       RiseFall::find(point.rf_index),
+                                       dcalc_ap);
+    point_caps_.push_back(cap);
+    prev_arrival = point.arrival;
+  }
+}
+
+uint32_t
+TimingPathsWriter::stringIndex(const void *key,
+                               const char *str)
+{
+  uint32_t index;
+  bool exists;
+  string_index_map_.findKey(key, index, exists);
+  if (!exists) {
+    index = strings_.size();
+    strings_.push_back(str);
+    string_index_map_[key] = index;
+  }
+  return index;
+}
+
+uint32_t
+TimingPathsWriter::pinIndex(const Pin *pin)
+{
+  uint32_t index;
+  bool exists;
+  string_index_map_.findKey(pin, index, exists);
+  if (!exists) {
+    index = strings_.size();
+    strings_.push_back(network_->pathName(pin));
+    string_index_map_[pin] = index;
+  }
+  return index;
+}
+
+uint32_t
+TimingPathsWriter::clkIndex(const ClockEdge *clk_edge)
+{
+  if (clk_edge) {
+    const Clock *clk = clk_edge->clock();
+    return stringIndex(clk, clk->name());
+  }
+  else
+    return string_index_none;
+}
+
+uint8_t
+TimingPathsWriter::clkRfIndex(const ClockEdge *clk_edge)
+{
+  if (clk_edge)
+    return clk_edge->transition()->index();
+  else
+    return rf_index_none;
+}
+
+template <class TYPE>
+void
+TimingPathsWriter::writeColumn(const vector<TYPE> &column)
+{
+  writeBytes(column.data(), sizeof(TYPE) * column.size());
+}
+
+void
+TimingPathsWriter::writeUint32(uint32_t value)
+{
+  writeBytes(&value, sizeof(value));
+}
+
+void
+TimingPathsWriter::writeBytes(const void *buffer,
+                              size_t size)
+{
+  if (size > 0
+      && fwrite(buffer, 1, size, stream_) != size) {
+    fclose(stream_);
+    stream_ = nullptr;
+    throw FileNotWritable(filename_);
+  }
+}
+
+} // namespace
@@ -185,6 +185,21 @@ proc edge_disable_reason { edge } {
 
 ################################################################
 
+define_cmd_args "report_graph_partitions" {[-count partition_count]}
+
+proc report_graph_partitions { args } {
+  parse_key_args "report_graph_partitions" args keys {-count} flags {}
+  check_argc_eq0 "report_graph_partitions" $args
+  set partition_count 2
+  if { [info exists keys(-count)] } {
+    set partition_count $keys(-count)
+    check_positive_integer "-count" $partition_count
+  }
+  report_graph_partitions_cmd $partition_count
+}
+
+################################################################
+
 define_cmd_args "report_constant" {pin|instance|net}
 
 proc report_constant { obj } {
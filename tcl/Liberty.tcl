@@ -19,18 +19,26 @@
 namespace eval sta {
 
 define_cmd_args "read_liberty" \
-  {[-corner corner] [-min] [-max] [-infer_latches] filename}
+  {[-corner corner] [-min] [-max] [-infer_latches] [-netlist_cells_only]\
+     filename}
 
 proc_redirect read_liberty {
   parse_key_args "read_liberty" args keys {-corner} \
-    flags {-min -max -infer_latches}
+    flags {-min -max -infer_latches -netlist_cells_only}
   check_argc_eq1 "read_liberty" $args
 
   set filename [file nativename [lindex $args 0]]
   set corner [parse_corner keys]
   set min_max [parse_min_max_all_flags flags]
   set infer_latches [info exists flags(-infer_latches)]
-  read_liberty_cmd $filename $corner $min_max $infer_latches
+  set cell_names {}
+  if { [info exists flags(-netlist_cells_only)] } {
+    set cell_names [verilog_inst_cell_names]
+    if { $cell_names == {} } {
+      sta_warn 1123 "-netlist_cells_only requires read_verilog before read_liberty."
+    }
+  }
+  read_liberty_cmd $filename $corner $min_max $infer_latches $cell_names
 }
 
 # for regression testing
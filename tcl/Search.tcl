@@ -415,6 +415,30 @@ proc_redirect report_checks {
 
 ################################################################
 
+define_cmd_args "write_timing_paths" \
+  {[-from from_list|-rise_from from_list|-fall_from from_list]\
+     [-through through_list|-rise_through through_list|-fall_through through_list]\
+     [-to to_list|-rise_to to_list|-fall_to to_list]\
+     [-unconstrained]\
+     [-path_delay min|min_rise|min_fall|max|max_rise|max_fall|min_max]\
+     [-corner corner]\
+     [-group_count path_count] \
+     [-endpoint_count path_count]\
+     [-unique_paths_to_endpoint]\
+     [-slack_max slack_max]\
+     [-slack_min slack_min]\
+     [-sort_by_slack]\
+     [-path_group group_name]\
+     filename}
+
+proc write_timing_paths { args } {
+  set path_ends [find_timing_paths_cmd "write_timing_paths" args]
+  check_argc_eq1 "write_timing_paths" $args
+  write_timing_paths_cmd $path_ends [file nativename [lindex $args 0]]
+}
+
+################################################################
+
 define_cmd_args "report_check_types" \
   {[-violators] [-verbose]\
      [-corner corner]\
@@ -70,6 +70,8 @@
 #include "PathAnalysisPt.hh"
 #include "Property.hh"
 #include "WritePathSpice.hh"
+#include "WriteTimingPaths.hh"
+#include "GraphPartition.hh"
 #include "Search.hh"
 #include "Sta.hh"
 #include "search/Tag.hh"
@@ -712,10 +714,14 @@ bool
 read_liberty_cmd(char *filename,
 		 Corner *corner,
 		 const MinMaxAll *min_max,
-		 bool infer_latches)
+		 bool infer_latches,
+		 StringSet *cell_names)
 {
   LibertyLibrary *lib = Sta::sta()->readLiberty(filename, corner, min_max,
-						infer_latches);
+						infer_latches,
+						cell_names->empty()
+						? nullptr : cell_names);
+  delete cell_names;
   return (lib != nullptr);
 }
 
@@ -2734,6 +2740,18 @@ set_crpr_mode(const char *mode)
     sta->report()->critical(1573, "unknown common clk pessimism mode.");
 }
 
+bool
+requireds_worst_per_clk()
+{
+  return Sta::sta()->requiredsWorstPerClk();
+}
+
+void
+set_requireds_worst_per_clk(bool enabled)
+{
+  Sta::sta()->setRequiredsWorstPerClk(enabled);
+}
+
 bool
 pocv_enabled()
 {
@@ -3552,6 +3570,26 @@ write_path_spice_cmd(PathRef *path,
 		 power_name, gnd_name, ckt_sim, sta);
 }
 
+void
+report_graph_partitions_cmd(int partition_count)
+{
+  cmdLinkedNetwork();
+  Sta *sta = Sta::sta();
+  sta->ensureGraph();
+  GraphPartition partition(partition_count, sta);
+  partition.partitionGraph();
+  partition.report();
+}
+
+void
+write_timing_paths_cmd(PathEndSeq *ends,
+                       const char *filename)
+{
+  cmdLinkedNetwork();
+  writeTimingPaths(ends, filename, Sta::sta());
+  delete ends;
+}
+
 void
 write_timing_model_cmd(const char *lib_name,
                        const char *cell_name,
@@ -4022,6 +4060,30 @@ processor_count()
   return processorCount();
 }
 
+void
+profile_begin()
+{
+  Stats::profileBegin();
+}
+
+void
+profile_end()
+{
+  Stats::profileEnd();
+}
+
+void
+write_profile_json(const char *filename)
+{
+  Stats::writeProfileJson(filename);
+}
+
+void
+write_profile_trace(const char *filename)
+{
+  Stats::writeProfileTrace(filename);
+}
+
 int
 thread_count()
 {
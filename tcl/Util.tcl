@@ -219,6 +219,29 @@ proc write_stats { filename } {
   }
 }
 
+# Defined by StaTcl.i
+define_cmd_args "profile_begin" {}
+define_cmd_args "profile_end" {}
+
+define_cmd_args "write_profile" {[-format json|trace] filename}
+
+proc write_profile { args } {
+  parse_key_args "write_profile" args keys {-format} flags {}
+  check_argc_eq1 "write_profile" $args
+  set filename [file nativename [lindex $args 0]]
+  set format "json"
+  if { [info exists keys(-format)] } {
+    set format $keys(-format)
+  }
+  if { $format == "json" } {
+    write_profile_json $filename
+  } elseif { $format == "trace" } {
+    write_profile_trace $filename
+  } else {
+    sta_error 577 "write_profile -format must be json or trace."
+  }
+}
+
 ################################################################
 
 # Begin/end logging all output to a file.
@@ -72,6 +72,14 @@ proc trace_crpr_mode { name1 name2 op } {
   }
 }
 
+trace variable ::sta_requireds_worst_per_clk "rw" \
+  sta::trace_requireds_worst_per_clk
+
+proc trace_requireds_worst_per_clk { name1 name2 op } {
+  trace_boolean_var $op ::sta_requireds_worst_per_clk \
+    requireds_worst_per_clk set_requireds_worst_per_clk
+}
+
 trace variable ::sta_cond_default_arcs_enabled "rw" \
   sta::trace_cond_default_arcs_enabled
 
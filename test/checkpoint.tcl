@@ -0,0 +1,89 @@
+# write_checkpoint/read_checkpoint round trip with conditional arcs
+read_liberty ../examples/sky130hd_tt.lib
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+read_sdc ../examples/gcd_sky130hd.sdc
+read_spef ../examples/gcd_sky130hd.spef
+
+# Sorted list of "from -> to cond arc delays" for every graph edge.
+proc graph_edge_delays {} {
+  set edge_delays {}
+  set vertex_iter [sta::vertex_iterator]
+  while {[$vertex_iter has_next]} {
+    set vertex [$vertex_iter next]
+    set edge_iter [$vertex out_edge_iterator]
+    while {[$edge_iter has_next]} {
+      set edge [$edge_iter next]
+      set from [sta::vertex_path_name [$edge from]]
+      set to [sta::vertex_path_name [$edge to]]
+      foreach arc [$edge timing_arcs] {
+        lappend edge_delays "$from -> $to [$edge role] [$edge cond] [$arc from_edge][$arc to_edge] [$edge arc_delay_strings $arc 4]"
+      }
+    }
+    $edge_iter finish
+  }
+  $vertex_iter finish
+  return [lsort $edge_delays]
+}
+
+# Count edges that share their from/to pins with another edge.
+proc parallel_edge_count {} {
+  set count 0
+  set vertex_iter [sta::vertex_iterator]
+  while {[$vertex_iter has_next]} {
+    set vertex [$vertex_iter next]
+    set edge_iter [$vertex out_edge_iterator]
+    array unset to_counts
+    while {[$edge_iter has_next]} {
+      set edge [$edge_iter next]
+      incr to_counts([$edge to])
+    }
+    $edge_iter finish
+    foreach to [array names to_counts] {
+      if { $to_counts($to) > 1 } {
+        incr count $to_counts($to)
+      }
+    }
+  }
+  $vertex_iter finish
+  return $count
+}
+
+proc parasitic_annotation {} {
+  sta::redirect_string_begin
+  report_parasitic_annotation
+  return [sta::redirect_string_end]
+}
+
+set checkpoint_dir [file join results checkpoint]
+write_checkpoint $checkpoint_dir
+puts "parallel edges [expr [parallel_edge_count] > 0]"
+
+# Read the checkpoint in a fresh sta without the original inputs.
+set expected_file [file join results checkpoint_expected.tcl]
+set stream [open $expected_file w]
+puts $stream [list set delays [graph_edge_delays]]
+puts $stream [list set slack [worst_slack -max]]
+puts $stream [list set annotation [parasitic_annotation]]
+close $stream
+
+set read_script [file join results checkpoint_read.tcl]
+set stream [open $read_script w]
+puts $stream [list proc graph_edge_delays {} [info body graph_edge_delays]]
+puts $stream [list proc parasitic_annotation {} [info body parasitic_annotation]]
+puts $stream [list source $expected_file]
+puts $stream [list read_checkpoint $checkpoint_dir]
+puts $stream {puts "checkpoint delays match [expr [graph_edge_delays] == $delays]"}
+puts $stream {puts "checkpoint slack matches [expr [worst_slack -max] == $slack]"}
+puts $stream {puts "checkpoint parasitics match [expr [parasitic_annotation] == $annotation]"}
+# Restored delays are not annotations; edits recompute them.
+puts $stream {set_load 0.1 [get_ports resp_val]}
+puts $stream {puts "checkpoint edit updates delays [expr [graph_edge_delays] != $delays]"}
+close $stream
+
+foreach line [split [exec [info nameofexecutable] -no_init -no_splash -exit \
+                       $read_script] "\n"] {
+  if { [string match "checkpoint *" $line] } {
+    puts $line
+  }
+}
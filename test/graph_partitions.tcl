@@ -0,0 +1,32 @@
+# report_graph_partitions
+read_liberty ../examples/sky130hd_tt.lib
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+
+with_output_to_variable report1 { report_graph_partitions -count 1 }
+set lines1 [split [string trimright $report1 "\n"] "\n"]
+regexp {Boundary vertices (\d+) of (\d+)} [lindex $lines1 end] \
+  ignore boundary1 total1
+puts "one partition boundary $boundary1"
+
+with_output_to_variable report4 { report_graph_partitions -count 4 }
+set lines4 [split [string trimright $report4 "\n"] "\n"]
+puts "lines [llength $lines4]"
+set header [lindex $lines4 0]
+set rule [lindex $lines4 1]
+puts "rule width match [expr [string length $rule] == [string length $header]]"
+puts "rules match [expr [lindex $lines4 end-1] == $rule]"
+set vertex_sum 0
+set vertex_max 0
+foreach line [lrange $lines4 2 end-2] {
+  puts "row width match [expr [string length $line] == [string length $header]]"
+  set vertices [lindex $line 1]
+  incr vertex_sum $vertices
+  set vertex_max [expr max($vertex_max, $vertices)]
+}
+regexp {Boundary vertices (\d+) of (\d+)} [lindex $lines4 end] \
+  ignore boundary4 total4
+puts "vertices match [expr $vertex_sum == $total4 && $total4 == $total1]"
+# gcd is flat, so partitions have to come from connectivity.
+puts "balanced [expr $vertex_max == ($total4 + 3) / 4]"
+puts "boundary [expr $boundary4 > 0 && $boundary4 < $total4]"
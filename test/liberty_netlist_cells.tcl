@@ -0,0 +1,14 @@
+# read_liberty -netlist_cells_only before and after link_design
+read_verilog ../examples/example1.v
+read_liberty -max -netlist_cells_only ../examples/nangate45_slow.lib
+link_design top
+# The verilog modules are deleted by link_design.
+read_liberty -min -netlist_cells_only ../examples/nangate45_fast.lib
+
+foreach lib [get_libs *] {
+  set cell_names {}
+  foreach cell [get_lib_cells [get_name $lib]/*] {
+    lappend cell_names [get_name $cell]
+  }
+  puts "cells [lsort $cell_names]"
+}
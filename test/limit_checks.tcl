@@ -0,0 +1,23 @@
+# slew/fanout/capacitance limit checks with one and several threads
+read_liberty ../examples/sky130hd_tt.lib
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+read_sdc ../examples/gcd_sky130hd.sdc
+read_spef ../examples/gcd_sky130hd.spef
+# Tight limits so some pins violate and many tie for the worst slack.
+set_max_fanout 4 [current_design]
+set_max_transition 0.2 [current_design]
+set_max_capacitance 0.01 [current_design]
+
+proc limit_reports {} {
+  with_output_to_variable reports {
+    report_check_types -max_slew -max_fanout -max_capacitance
+    report_check_types -max_slew -max_fanout -max_capacitance -violators
+  }
+  return $reports
+}
+
+sta::set_thread_count 1
+set reports [limit_reports]
+sta::set_thread_count 4
+puts "limits match [expr [limit_reports] == $reports]"
@@ -0,0 +1,32 @@
+# get_cells glob patterns
+read_liberty ../examples/nangate45_slow.lib
+read_verilog pattern_match.v
+link_design pattern_match
+
+proc report_matches { pattern } {
+  set names {}
+  foreach inst [get_cells -quiet $pattern] {
+    lappend names [get_full_name $inst]
+  }
+  set line "$pattern:"
+  foreach name [lsort $names] {
+    append line " $name"
+  }
+  puts $line
+}
+
+report_matches *
+report_matches a*
+# Trailing '*'s match an empty suffix, so 'a' matches. Before the
+# iterative matcher 'a**' only matched names longer than 'a'.
+report_matches a**
+report_matches a?
+report_matches a*c
+report_matches *b*c
+report_matches ?
+# Escaped bus brackets are part of the literal prefix.
+report_matches {a\[*}
+report_matches {a\[?\]}
+report_matches {*\]}
+report_matches {a\[1\]}
+report_matches c*
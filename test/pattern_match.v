@@ -0,0 +1,13 @@
+module pattern_match (in1);
+  input in1;
+  wire w1, w2, w3, w4, w5, w6, w7, w8;
+
+  BUF_X1 a (.A(in1), .Z(w1));
+  BUF_X1 aa (.A(in1), .Z(w2));
+  BUF_X1 ab (.A(in1), .Z(w3));
+  BUF_X1 abc (.A(in1), .Z(w4));
+  BUF_X1 a_b_c (.A(in1), .Z(w5));
+  BUF_X1 b (.A(in1), .Z(w6));
+  BUF_X1 \a[0]  (.A(in1), .Z(w7));
+  BUF_X1 \a[1]  (.A(in1), .Z(w8));
+endmodule
@@ -0,0 +1,15 @@
+# activity propagation thru cell functions
+read_liberty ../examples/nangate45_slow.lib
+read_verilog power_activity.v
+link_design power_activity
+create_clock -name clk -period 10 clk
+set_input_delay -clock clk 0 {in1 in2 in3}
+set_power_activity -pins {r1/Q r2/Q r3/Q} -activity 0.2 -duty 0.5
+# Z = A
+puts "u1/Z [get_property [get_pins u1/Z] activity]"
+# ZN = A1 & A2
+puts "u2/ZN [get_property [get_pins u2/ZN] activity]"
+# Z = A ^ B, both inputs always sensitize the output
+puts "u3/Z [get_property [get_pins u3/Z] activity]"
+# Z = (S & B) | (A & !S), each input sensitizes the output half the time
+puts "u4/Z [get_property [get_pins u4/Z] activity]"
@@ -0,0 +1,16 @@
+module power_activity (in1, in2, in3, clk, out1, out2, out3);
+  input in1, in2, in3, clk;
+  output out1, out2, out3;
+  wire r1q, r2q, r3q, u1z, u2z, u3z, u4z;
+
+  DFF_X1 r1 (.D(in1), .CK(clk), .Q(r1q));
+  DFF_X1 r2 (.D(in2), .CK(clk), .Q(r2q));
+  DFF_X1 r3 (.D(in3), .CK(clk), .Q(r3q));
+  BUF_X1 u1 (.A(r2q), .Z(u1z));
+  AND2_X1 u2 (.A1(r1q), .A2(u1z), .ZN(u2z));
+  XOR2_X1 u3 (.A(r1q), .B(r2q), .Z(u3z));
+  MUX2_X1 u4 (.A(r1q), .B(r2q), .S(r3q), .Z(u4z));
+  DFF_X1 r4 (.D(u2z), .CK(clk), .Q(out1));
+  DFF_X1 r5 (.D(u3z), .CK(clk), .Q(out2));
+  DFF_X1 r6 (.D(u4z), .CK(clk), .Q(out3));
+endmodule
@@ -123,7 +123,17 @@ record_example_tests {
 
 record_sta_tests {
   ccs_sim1
+  checkpoint
+  graph_partitions
+  liberty_netlist_cells
+  limit_checks
+  pattern_match
+  power_activity
+  requireds_worst_per_clk
+  sdf_gzip
   verilog_attribute
+  write_profile
+  write_timing_paths
 }
 
 define_test_group fast [group_tests all]
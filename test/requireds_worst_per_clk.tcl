@@ -0,0 +1,28 @@
+# sta_requireds_worst_per_clk with exception state tags
+read_liberty ../examples/nangate45_slow.lib
+read_verilog ../examples/example1.v
+link_design top
+create_clock -name clk -period 10 {clk1 clk2 clk3}
+set_input_delay -clock clk 0 {in1 in2}
+# Paths from r2 reach r3/D with a multicycle exception state and paths
+# from r1 without one, so the r3/D tags must not share a required.
+set_multicycle_path -setup 2 -through u1/Z
+
+proc timing_reports {} {
+  with_output_to_variable reports {
+    report_checks -group_count 10 -endpoint_count 10
+    report_checks -through u1/Z
+    report_wns
+    report_tns
+  }
+  return $reports
+}
+
+set sta_requireds_worst_per_clk 0
+set reports [timing_reports]
+sta::find_requireds
+set required_count [sta::required_count]
+set sta_requireds_worst_per_clk 1
+puts "requireds match [expr [timing_reports] == $reports]"
+sta::find_requireds
+puts "requireds shared [expr [sta::required_count] < $required_count]"
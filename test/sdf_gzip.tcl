@@ -0,0 +1,25 @@
+# write_sdf -gzip read back with read_sdf
+read_liberty ../examples/sky130hd_tt.lib
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+read_sdc ../examples/gcd_sky130hd.sdc
+read_spef ../examples/gcd_sky130hd.spef
+
+proc read_file { filename } {
+  set stream [open $filename r]
+  fconfigure $stream -translation binary
+  set text [read $stream]
+  close $stream
+  return $text
+}
+
+sta::set_thread_count 4
+write_sdf -no_timestamp -no_version results/sdf_gzip.sdf
+write_sdf -gzip -no_timestamp -no_version results/sdf_gzip.sdf.gz
+set gz [read_file results/sdf_gzip.sdf.gz]
+binary scan $gz H4 magic
+puts "gzip magic $magic"
+read_sdf results/sdf_gzip.sdf.gz
+write_sdf -no_timestamp -no_version results/sdf_gzip_reread.sdf
+puts "sdf match [expr [read_file results/sdf_gzip_reread.sdf] \
+                  == [read_file results/sdf_gzip.sdf]]"
@@ -0,0 +1,28 @@
+# write_profile json and chrome trace
+read_liberty ../examples/nangate45_slow.lib
+read_verilog ../examples/example1.v
+link_design top
+create_clock -name clk -period 10 {clk1 clk2 clk3}
+set_input_delay -clock clk 0 {in1 in2}
+
+proc read_file { filename } {
+  set stream [open $filename r]
+  set text [read $stream]
+  close $stream
+  return $text
+}
+
+profile_begin
+with_output_to_variable ignore { report_checks }
+profile_end
+write_profile results/write_profile.json
+write_profile -format trace results/write_profile.trace
+
+set json [read_file results/write_profile.json]
+puts "json steps [regexp {^\{\n  "steps": \[} $json]"
+puts "json visits [regexp {"vertex_visits": [1-9]} $json]"
+set trace [read_file results/write_profile.trace]
+puts "trace events [regexp {^\{"traceEvents": \[} $trace]"
+puts "trace counts [regexp {"name": "counts", "ph": "C"} $trace]"
+puts [catch {write_profile -format xml results/write_profile.xml} msg]
+puts $msg
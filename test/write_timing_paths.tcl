@@ -0,0 +1,27 @@
+# write_timing_paths read back
+read_liberty ../examples/nangate45_slow.lib
+read_verilog ../examples/example1.v
+link_design top
+create_clock -name clk -period 10 {clk1 clk2 clk3}
+set_input_delay -clock clk 0 {in1 in2}
+
+write_timing_paths -group_count 10 -endpoint_count 2 results/write_timing_paths.bin
+set path_ends [find_timing_paths -group_count 10 -endpoint_count 2]
+
+set stream [open results/write_timing_paths.bin r]
+fconfigure $stream -translation binary
+set data [read $stream]
+close $stream
+
+binary scan $data a8iuiuiu magic path_count point_count string_count
+puts "magic $magic"
+puts "paths match [expr $path_count == [llength $path_ends]]"
+# Skip the string table to find the size of the columns.
+set offset 20
+for {set i 0} {$i < $string_count} {incr i} {
+  binary scan $data @${offset}iu length
+  incr offset [expr 4 + $length]
+}
+# Path columns are 56 bytes and point columns 26 bytes per entry.
+set size [expr $offset + $path_count * 56 + $point_count * 26]
+puts "size match [expr $size == [string length $data]]"
@@ -8,9 +8,16 @@
 namespace sta {
 
 DispatchQueue::DispatchQueue(size_t thread_count) :
-  threads_(thread_count),
   pending_task_count_(0)
 {
+  startThreads(thread_count);
+}
+
+void
+DispatchQueue::startThreads(size_t thread_count)
+{
+  quit_ = false;
+  threads_.resize(thread_count);
   for(size_t i = 0; i < thread_count; i++)
     threads_[i] = std::thread(&DispatchQueue::dispatch_thread_handler, this, i);
 }
@@ -41,11 +48,7 @@ void
 DispatchQueue::setThreadCount(size_t thread_count)
 {
   terminateThreads();
-
-  threads_.resize(thread_count);
-  for(size_t i = 0; i < thread_count; i++) {
-    threads_[i] = std::thread(&DispatchQueue::dispatch_thread_handler, this, i);
-  }
+  startThreads(thread_count);
 }
 
 void
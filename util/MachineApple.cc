@@ -77,4 +77,12 @@ memoryUsage()
   return rusage.ru_maxrss;
 }
 
+size_t
+peakMemoryUsage()
+{
+  struct rusage rusage;
+  getrusage(RUSAGE_SELF, &rusage);
+  return rusage.ru_maxrss;
+}
+
 } // namespace
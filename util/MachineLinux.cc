@@ -69,9 +69,9 @@ systemRunTime()
   return rusage.ru_stime.tv_sec + rusage.ru_stime.tv_usec * 1e-6;
 }
 
-// rusage->ru_maxrss is not set in linux so read it from /proc.
-size_t
-memoryUsage()
+// Memory field from /proc/<pid>/status in bytes.
+static size_t
+procStatusMemory(const char *field_name)
 {
   string proc_filename;
   stringPrint(proc_filename, "/proc/%d/status", getpid());
@@ -82,11 +82,11 @@ memoryUsage()
     char line[line_length];
     while (fgets(line, line_length, status) != nullptr) {
       char *field = strtok(line, " \t");
-      if (field && stringEq(field, "VmRSS:")) {
+      if (field && stringEq(field, field_name)) {
 	char *size = strtok(nullptr, " \t");
 	if (size) {
 	  char *ignore;
-	  // VmRSS is in kilobytes.
+	  // Memory fields are in kilobytes.
 	  memory = strtol(size, &ignore, 10) * 1000;
 	  break;
 	}
@@ -97,4 +97,17 @@ memoryUsage()
   return memory;
 }
 
+// rusage->ru_maxrss is not set in linux so read it from /proc.
+size_t
+memoryUsage()
+{
+  return procStatusMemory("VmRSS:");
+}
+
+size_t
+peakMemoryUsage()
+{
+  return procStatusMemory("VmHWM:");
+}
+
 } // namespace
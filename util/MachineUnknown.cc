@@ -53,4 +53,10 @@ memoryUsage()
   return 0;
 }
 
+size_t
+peakMemoryUsage()
+{
+  return 0;
+}
+
 } // namespace
@@ -101,4 +101,10 @@ memoryUsage()
   return 0;
 }
 
+size_t
+peakMemoryUsage()
+{
+  return 0;
+}
+
 } // namespace
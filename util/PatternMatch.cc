@@ -101,6 +101,15 @@ PatternMatch::hasWildcards() const
     return patternWildcards(pattern_);
 }
 
+size_t
+PatternMatch::literalPrefixLength() const
+{
+  if (is_regexp_ || nocase_)
+    return 0;
+  else
+    return strcspn(pattern_, "*?");
+}
+
 bool
 PatternMatch::match(const string &str) const
 {
@@ -147,25 +156,7 @@ bool
 patternMatch(const char *pattern,
 	     const char *str)
 {
-  const char *p = pattern;
-  const char *s = str;
-
-  while (*p && *s && (*s == *p || *p == '?')) {
-    p++;
-    s++;
-  }
-  if (*p == '\0' && *s == '\0')
-    return true;
-  else if (*p == '*') {
-    if (p[1] == '\0')
-      return true;
-    while (*s) {
-      if (patternMatch(p + 1, s))
-	return true;
-      s++;
-    }
-  }
-  return false;
+  return patternMatchNoCase(pattern, str, false);
 }
 
 inline
@@ -178,6 +169,9 @@ bool equalCase(char s,
     : s == p;
 }
 
+// Iterative glob match that only backtracks to the most recent '*',
+// so the cost is bounded by pattern length * string length instead of
+// growing exponentially with the number of '*'s.
 bool
 patternMatchNoCase(const char *pattern,
 		   const char *str,
@@ -185,23 +179,29 @@ patternMatchNoCase(const char *pattern,
 {
   const char *p = pattern;
   const char *s = str;
+  const char *star_p = nullptr;
+  const char *star_s = nullptr;
 
-  while (*p && *s && (equalCase(*s, *p, nocase) || *p == '?')) {
-    p++;
-    s++;
-  }
-  if (*p == '\0' && *s == '\0')
-    return true;
-  else if (*p == '*') {
-    if (p[1] == '\0')
-      return true;
-    while (*s) {
-      if (patternMatchNoCase(p + 1, s, nocase))
-	return true;
+  while (*s) {
+    if (*p == '*') {
+      star_p = p++;
+      star_s = s;
+    }
+    else if (*p && (*p == '?' || equalCase(*s, *p, nocase))) {
+      p++;
       s++;
     }
+    else if (star_p) {
+      // Let the last '*' absorb one more character.
+      p = star_p + 1;
+      s = ++star_s;
+    }
+    else
+      return false;
   }
-  return false;
+  while (*p == '*')
+    p++;
+  return *p == '\0';
 }
 
 bool
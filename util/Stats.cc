@@ -16,28 +16,115 @@
 
 #include "Stats.hh"
 
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <algorithm>
+
 #include "Machine.hh"
 #include "StringUtil.hh"
+#include "Error.hh"
 #include "Report.hh"
 #include "Debug.hh"
 
 namespace sta {
 
+using std::string;
+
+// Step recorded while profiling. Times are in seconds.
+class StatsStep
+{
+public:
+  string name;
+  int depth;
+  int thread;
+  double begin;
+  double elapsed;
+  double user;
+  size_t memory;
+  size_t peak_memory;
+};
+
+// Event counts for one thread. The counts are only written by the
+// owning thread so incrementing them does not need a lock. They are
+// atomic so other threads can read them while they are incremented.
+class StatsThreadCounts
+{
+public:
+  StatsThreadCounts();
+  ~StatsThreadCounts();
+
+  std::atomic<size_t> counts[static_cast<int>(StatsCount::count)];
+  int thread_index;
+};
+
+static const char *count_names[] = {"vertex_visits",
+                                    "arc_delay_calcs",
+                                    "tags_created"};
+static const int count_count = static_cast<int>(StatsCount::count);
+
+std::atomic<bool> Stats::profiling_(false);
+static double profile_begin_time = 0.0;
+static std::mutex profile_lock;
+static std::vector<StatsStep> profile_steps;
+static std::vector<StatsThreadCounts*> profile_thread_counts;
+// Counts from threads that have exited.
+static size_t profile_exited_counts[count_count];
+// Count totals when profiling began. The thread counts are never reset
+// because only the owning thread writes them.
+static size_t profile_begin_counts[count_count];
+static int profile_thread_index_next = 0;
+
+static thread_local StatsThreadCounts thread_counts;
+// Nesting depth of the Stats on this thread.
+static thread_local int thread_stats_depth = 0;
+
+StatsThreadCounts::StatsThreadCounts()
+{
+  for (int i = 0; i < count_count; i++)
+    counts[i].store(0, std::memory_order_relaxed);
+  std::lock_guard<std::mutex> lock(profile_lock);
+  thread_index = profile_thread_index_next++;
+  profile_thread_counts.push_back(this);
+}
+
+StatsThreadCounts::~StatsThreadCounts()
+{
+  std::lock_guard<std::mutex> lock(profile_lock);
+  for (int i = 0; i < count_count; i++)
+    profile_exited_counts[i] += counts[i].load(std::memory_order_relaxed);
+  auto itr = std::find(profile_thread_counts.begin(),
+                       profile_thread_counts.end(), this);
+  if (itr != profile_thread_counts.end())
+    profile_thread_counts.erase(itr);
+}
+
 Stats::Stats(Debug *debug,
              Report *report) :
   elapsed_begin_(0.0),
   user_begin_(0.0),
   system_begin_(0.0),
   memory_begin_(0),
+  depth_(-1),
   debug_(debug),
   report_(report)
 {
-  if (debug->statsLevel() > 0) {
+  bool profiling = Stats::profiling();
+  if (debug->statsLevel() > 0 || profiling) {
     elapsed_begin_ = elapsedRunTime();
     user_begin_ = userRunTime();
     system_begin_ = systemRunTime();
     memory_begin_ = memoryUsage();
   }
+  if (profiling)
+    depth_ = thread_stats_depth++;
+}
+
+Stats::~Stats()
+{
+  if (depth_ >= 0)
+    thread_stats_depth--;
 }
 
 void
@@ -55,6 +142,188 @@ Stats::report(const char *step)
                         memory_delta * 1e-6, memory_end * 1e-6,
                         step);
   }
+  if (profiling() && depth_ >= 0) {
+    StatsStep stats_step;
+    stats_step.name = step;
+    stats_step.depth = depth_;
+    stats_step.thread = thread_counts.thread_index;
+    stats_step.elapsed = elapsedRunTime() - elapsed_begin_;
+    stats_step.user = userRunTime() - user_begin_;
+    stats_step.memory = memoryUsage();
+    stats_step.peak_memory = peakMemoryUsage();
+    std::lock_guard<std::mutex> lock(profile_lock);
+    stats_step.begin = elapsed_begin_ - profile_begin_time;
+    profile_steps.push_back(stats_step);
+  }
+}
+
+////////////////////////////////////////////////////////////////
+
+// Caller holds profile_lock.
+static void
+sumThreadCounts(// Return value.
+                size_t counts[count_count])
+{
+  for (int i = 0; i < count_count; i++)
+    counts[i] = profile_exited_counts[i];
+  for (StatsThreadCounts *thread_counts : profile_thread_counts) {
+    for (int i = 0; i < count_count; i++)
+      counts[i] += thread_counts->counts[i].load(std::memory_order_relaxed);
+  }
+}
+
+void
+Stats::profileBegin()
+{
+  std::lock_guard<std::mutex> lock(profile_lock);
+  profile_steps.clear();
+  sumThreadCounts(profile_begin_counts);
+  profile_begin_time = elapsedRunTime();
+  profiling_ = true;
+}
+
+void
+Stats::profileEnd()
+{
+  profiling_ = false;
+}
+
+void
+Stats::incrCount1(StatsCount count)
+{
+  // Only this thread writes its counts so a relaxed load and store
+  // is enough (and cheaper than an atomic increment).
+  std::atomic<size_t> &thread_count = thread_counts.counts[static_cast<int>(count)];
+  thread_count.store(thread_count.load(std::memory_order_relaxed) + 1,
+                     std::memory_order_relaxed);
+}
+
+// Counts since profiling began.
+static void
+sumCounts(// Return value.
+          size_t counts[count_count])
+{
+  std::lock_guard<std::mutex> lock(profile_lock);
+  sumThreadCounts(counts);
+  for (int i = 0; i < count_count; i++)
+    counts[i] -= profile_begin_counts[i];
+}
+
+static bool
+stepBeginLess(const StatsStep &step1,
+              const StatsStep &step2)
+{
+  return step1.begin < step2.begin
+    || (step1.begin == step2.begin
+        && step1.depth < step2.depth);
+}
+
+// Steps are recorded when they end; sort them by start time.
+static std::vector<StatsStep>
+sortedSteps()
+{
+  std::lock_guard<std::mutex> lock(profile_lock);
+  std::vector<StatsStep> steps = profile_steps;
+  std::stable_sort(steps.begin(), steps.end(), stepBeginLess);
+  return steps;
+}
+
+static void
+writeJsonString(FILE *stream,
+                const char *str)
+{
+  fputc('"', stream);
+  for (const char *s = str; *s; s++) {
+    char ch = *s;
+    if (ch == '"' || ch == '\\')
+      fprintf(stream, "\\%c", ch);
+    else if (static_cast<unsigned char>(ch) < ' ')
+      fprintf(stream, "\\u%04x", ch);
+    else
+      fputc(ch, stream);
+  }
+  fputc('"', stream);
+}
+
+void
+Stats::writeProfileJson(const char *filename)
+{
+  FILE *stream = fopen(filename, "w");
+  if (stream == nullptr)
+    throw FileNotWritable(filename);
+  std::vector<StatsStep> steps = sortedSteps();
+  fprintf(stream, "{\n  \"steps\": [");
+  bool first = true;
+  for (const StatsStep &step : steps) {
+    fprintf(stream, "%s\n    {\"name\": ", first ? "" : ",");
+    writeJsonString(stream, step.name.c_str());
+    fprintf(stream, ", \"depth\": %d, \"thread\": %d, \"begin\": %.6f, "
+            "\"elapsed\": %.6f, \"user\": %.6f, "
+            "\"memory\": %zu, \"peak_memory\": %zu}",
+            step.depth,
+            step.thread,
+            step.begin,
+            step.elapsed,
+            step.user,
+            step.memory,
+            step.peak_memory);
+    first = false;
+  }
+  fprintf(stream, "\n  ],\n  \"counts\": {");
+  size_t counts[count_count];
+  sumCounts(counts);
+  for (int i = 0; i < count_count; i++)
+    fprintf(stream, "%s\n    \"%s\": %zu",
+            i == 0 ? "" : ",",
+            count_names[i],
+            counts[i]);
+  fprintf(stream, "\n  },\n  \"peak_memory\": %zu\n}\n",
+          peakMemoryUsage());
+  // Buffered write errors show up when the stream is flushed.
+  if (fclose(stream) != 0)
+    throw FileNotWritable(filename);
+}
+
+// Chrome trace event format complete ("X") events with times in
+// microseconds. The counts are written as one counter ("C") event.
+void
+Stats::writeProfileTrace(const char *filename)
+{
+  FILE *stream = fopen(filename, "w");
+  if (stream == nullptr)
+    throw FileNotWritable(filename);
+  std::vector<StatsStep> steps = sortedSteps();
+  fprintf(stream, "{\"traceEvents\": [");
+  double end = 0.0;
+  for (const StatsStep &step : steps) {
+    fprintf(stream, "\n  {\"name\": ");
+    writeJsonString(stream, step.name.c_str());
+    fprintf(stream, ", \"cat\": \"sta\", \"ph\": \"X\", "
+            "\"ts\": %.0f, \"dur\": %.0f, \"pid\": 0, \"tid\": %d, "
+            "\"args\": {\"user\": %.6f, \"memory\": %zu, "
+            "\"peak_memory\": %zu}},",
+            step.begin * 1e6,
+            step.elapsed * 1e6,
+            step.thread,
+            step.user,
+            step.memory,
+            step.peak_memory);
+    end = std::max(end, step.begin + step.elapsed);
+  }
+  size_t counts[count_count];
+  sumCounts(counts);
+  fprintf(stream, "\n  {\"name\": \"counts\", \"ph\": \"C\", "
+          "\"ts\": %.0f, \"pid\": 0, \"args\": {",
+          end * 1e6);
+  for (int i = 0; i < count_count; i++)
+    fprintf(stream, "%s\"%s\": %zu",
+            i == 0 ? "" : ", ",
+            count_names[i],
+            counts[i]);
+  fprintf(stream, "}}\n],\n\"displayTimeUnit\": \"ms\"}\n");
+  // Buffered write errors show up when the stream is flushed.
+  if (fclose(stream) != 0)
+    throw FileNotWritable(filename);
 }
 
 } // namespace
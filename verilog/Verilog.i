@@ -25,6 +25,8 @@
 using sta::Sta;
 using sta::NetworkReader;
 using sta::readVerilogFile;
+using sta::StringSet;
+using sta::verilogInstCellNames;
 
 %}
 
@@ -49,6 +51,17 @@ delete_verilog_reader()
   deleteVerilogReader();
 }
 
+StringSeq
+verilog_inst_cell_names()
+{
+  StringSet cell_names;
+  verilogInstCellNames(cell_names);
+  StringSeq names;
+  for (const char *name : cell_names)
+    names.push_back(name);
+  return names;
+}
+
 void
 write_verilog_cmd(const char *filename,
 		  bool sort,
@@ -66,6 +66,14 @@ deleteVerilogReader()
   verilog_reader = nullptr;
 }
 
+void
+verilogInstCellNames(// Return value.
+		     StringSet &cell_names)
+{
+  if (verilog_reader)
+    verilog_reader->instCellNames(cell_names);
+}
+
 ////////////////////////////////////////////////////////////////
 
 class VerilogError
@@ -150,6 +158,7 @@ VerilogReader::VerilogReader(NetworkReader *network) :
 VerilogReader::~VerilogReader()
 {
   deleteModules();
+  deleteContents(&linked_cell_names_);
   stringDelete(constant10_max_);
 }
 
@@ -184,6 +193,47 @@ VerilogReader::read(const char *filename)
     throw FileNotReadable(filename);
 }
 
+void
+VerilogReader::instCellNames(// Return value.
+			     StringSet &cell_names) const
+{
+  moduleInstCellNames(cell_names);
+  for (const char *cell_name : linked_cell_names_)
+    cell_names.insert(cell_name);
+}
+
+void
+VerilogReader::moduleInstCellNames(// Return value.
+				   StringSet &cell_names) const
+{
+  for (const auto &cell_module : module_map_) {
+    VerilogModule *module = cell_module.second;
+    for (VerilogStmt *stmt : *module->stmts()) {
+      if (stmt->isModuleInst()) {
+	VerilogModuleInst *mod_inst = dynamic_cast<VerilogModuleInst*>(stmt);
+	cell_names.insert(mod_inst->moduleName());
+      }
+      else if (stmt->isLibertyInst()) {
+	VerilogLibertyInst *lib_inst = dynamic_cast<VerilogLibertyInst*>(stmt);
+	cell_names.insert(lib_inst->cell()->name());
+      }
+    }
+  }
+}
+
+// Linking deletes the module statements, so keep the instantiated
+// cell names for read_liberty -netlist_cells_only after link_design.
+void
+VerilogReader::saveLinkedCellNames()
+{
+  deleteContents(&linked_cell_names_);
+  linked_cell_names_.clear();
+  StringSet cell_names;
+  moduleInstCellNames(cell_names);
+  for (const char *cell_name : cell_names)
+    linked_cell_names_.insert(stringCopy(cell_name));
+}
+
 void
 VerilogReader::init(const char *filename)
 {
@@ -850,7 +900,8 @@ VerilogModule::VerilogModule(const char *name,
   filename_(filename),
   ports_(ports),
   stmts_(stmts),
-  attribute_stmts_(attribute_stmts)
+  attribute_stmts_(attribute_stmts),
+  link_count_(0)
 {
   parseStmts(reader);
 }
@@ -866,6 +917,28 @@ VerilogModule::~VerilogModule()
   stringDelete(name_);
 }
 
+void
+VerilogModule::setLinkCount(size_t count)
+{
+  link_count_ = count;
+}
+
+void
+VerilogModule::decrLinkCount()
+{
+  if (link_count_ > 0)
+    link_count_--;
+}
+
+void
+VerilogModule::deleteStmts()
+{
+  // The declaration map keys are owned by the declaration statements.
+  dcl_map_.clear();
+  stmts_->deleteContents();
+  stmts_->clear();
+}
+
 void
 VerilogModule::parseStmts(VerilogReader *reader)
 {
@@ -1847,6 +1920,8 @@ VerilogReader::linkNetwork(const char *top_cell_name,
 	}
 	delete net_name_iter;
       }
+      saveLinkedCellNames();
+      countModuleLinks(module);
       makeModuleInstBody(module, top_instance, &bindings, make_black_boxes);
       bool errors = reportLinkErrors(report);
       deleteModules();
@@ -1868,6 +1943,70 @@ VerilogReader::linkNetwork(const char *top_cell_name,
   }
 }
 
+// Count the number of times each module in the hierarchy below
+// top_module is expanded so the module statements can be deleted as
+// soon as the last instance is linked instead of holding every module
+// until the whole network is built.
+void
+VerilogReader::countModuleLinks(VerilogModule *top_module)
+{
+  set<VerilogModule*> visited;
+  VerilogModuleSeq modules;
+  sortModules(top_module, visited, modules);
+  for (VerilogModule *module : modules)
+    module->setLinkCount(0);
+  top_module->setLinkCount(1);
+  // Modules are sorted with instantiated modules before their parents,
+  // so walk backwards to visit parents first.
+  for (auto module_iter = modules.rbegin();
+       module_iter != modules.rend();
+       module_iter++) {
+    VerilogModule *module = *module_iter;
+    for (VerilogStmt *stmt : *module->stmts()) {
+      if (stmt->isModuleInst()) {
+	VerilogModule *inst_module =
+	  instModule(dynamic_cast<VerilogModuleInst*>(stmt));
+	if (inst_module)
+	  inst_module->setLinkCount(inst_module->linkCount()
+				    + module->linkCount());
+      }
+    }
+  }
+}
+
+void
+VerilogReader::sortModules(VerilogModule *module,
+			   set<VerilogModule*> &visited,
+			   // Return value.
+			   VerilogModuleSeq &modules)
+{
+  if (visited.find(module) == visited.end()) {
+    visited.insert(module);
+    for (VerilogStmt *stmt : *module->stmts()) {
+      if (stmt->isModuleInst()) {
+	VerilogModule *inst_module =
+	  instModule(dynamic_cast<VerilogModuleInst*>(stmt));
+	if (inst_module)
+	  sortModules(inst_module, visited, modules);
+      }
+    }
+    modules.push_back(module);
+  }
+}
+
+// Module that makeModuleInstNetwork expands for mod_inst.
+VerilogModule *
+VerilogReader::instModule(VerilogModuleInst *mod_inst)
+{
+  Cell *cell = network_->findAnyCell(mod_inst->moduleName());
+  if (cell
+      && network_->libertyCell(cell) == nullptr
+      && !network_->isLeaf(cell))
+    return module(cell);
+  else
+    return nullptr;
+}
+
 void
 VerilogReader::makeModuleInstBody(VerilogModule *module,
 				  Instance *inst,
@@ -1906,6 +2045,9 @@ VerilogReader::makeModuleInstBody(VerilogModule *module,
       mergeAssignNet(dynamic_cast<VerilogAssign*>(stmt), module, inst,
 		     bindings);
   }
+  module->decrLinkCount();
+  if (module->linkCount() == 0)
+    module->deleteStmts();
 }
 
 void
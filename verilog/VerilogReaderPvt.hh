@@ -69,6 +69,7 @@ typedef Vector<VerilogStmt*> VerilogStmtSeq;
 typedef Map<const char*, VerilogDcl*, CharPtrLess> VerilogDclMap;
 typedef Vector<VerilogDclArg*> VerilogDclArgSeq;
 typedef Map<Cell*, VerilogModule*> VerilogModuleMap;
+typedef Vector<VerilogModule*> VerilogModuleSeq;
 typedef Vector<VerilogError*> VerilogErrorSeq;
 typedef Vector<bool> VerilogConstantValue;
 // Max base 10 constant net value (for strtoll).
@@ -82,6 +83,10 @@ public:
   explicit VerilogReader(NetworkReader *network);
   ~VerilogReader();
   bool read(const char *filename);
+  // Cells instantiated by the modules that have been read, or by the
+  // last linked design once link has deleted the modules.
+  void instCellNames(// Return value.
+		     StringSet &cell_names) const;
   // flex YY_INPUT yy_n_chars arg changed definition from int to size_t,
   // so provide both forms.
   void getChars(char *buf,
@@ -184,6 +189,9 @@ public:
 
 protected:
   void init(const char *filename);
+  void moduleInstCellNames(// Return value.
+			   StringSet &cell_names) const;
+  void saveLinkedCellNames();
   void makeCellPorts(Cell *cell,
 		     VerilogModule *module,
 		     VerilogNetSeq *ports);
@@ -196,6 +204,12 @@ protected:
 				 set<string> &port_names);
   void checkModuleDcls(VerilogModule *module,
 		       set<string> &port_names);
+  void countModuleLinks(VerilogModule *top_module);
+  void sortModules(VerilogModule *module,
+		   set<VerilogModule*> &visited,
+		   // Return value.
+		   VerilogModuleSeq &modules);
+  VerilogModule *instModule(VerilogModuleInst *mod_inst);
   void makeModuleInstBody(VerilogModule *module,
 			  Instance *inst,
 			  VerilogBindingTbl *bindings,
@@ -287,6 +301,8 @@ protected:
   int black_box_index_;
   VerilogModuleMap module_map_;
   VerilogErrorSeq link_errors_;
+  // Copies of the cell names instantiated by the linked design.
+  StringSet linked_cell_names_;
   const char *zero_net_name_;
   const char *one_net_name_;
   const char *constant10_max_;
@@ -353,6 +369,13 @@ public:
   VerilogDclMap *declarationMap() { return &dcl_map_; }
   void parseDcl(VerilogDcl *dcl,
 		VerilogReader *reader);
+  // Number of module instances that remain to be linked.
+  size_t linkCount() const { return link_count_; }
+  void setLinkCount(size_t count);
+  void decrLinkCount();
+  // Delete the statements and declarations once the module is linked.
+  // The ports are kept because they name the cell ports.
+  void deleteStmts();
 
 private:
   void parseStmts(VerilogReader *reader);
@@ -366,6 +389,7 @@ private:
   VerilogStmtSeq *stmts_;
   VerilogDclMap dcl_map_;
   VerilogAttributeStmtSeq *attribute_stmts_;
+  size_t link_count_;
 };
 
 class VerilogDcl : public VerilogStmt